@@ -606,7 +606,9 @@ void loop() {
 
 //hack for Arduino to be able to play with function that have struct as parameters.
 
-
+// a fixed-point NeuralNetwork.h (NeuralNetworkFixed.h in the FileViewer
+// results) brings its own implementation
+#ifndef FIXED_POINT_BRAIN
 
 void initNetwork(NeuralNetwork* network, unsigned int nInputs, unsigned int nOutputs, 
                   unsigned int nHidden, const float *weights, const float* params,
@@ -739,3 +741,4 @@ void fetch(const NeuralNetwork* network, float *output) {
 
 }
 
+#endif /* FIXED_POINT_BRAIN */
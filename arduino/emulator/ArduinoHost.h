@@ -0,0 +1,61 @@
+/*
+ * @(#) ArduinoHost.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * What the generated NeuralNetwork.h files need from the Arduino
+ * environment and RobogenArduino.ino, to be compiled on the host
+ */
+
+#ifndef ROBOGEN_ARDUINO_HOST_H_
+#define ROBOGEN_ARDUINO_HOST_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+
+/* pins, as in RobogenArduino.ino */
+#define D9 (9)
+#define D10 (10)
+#define D5 (5)
+#define D6 (6)
+#define D11 (11)
+#define D13 (13)
+#define ROLL (16)
+#define PITCH (14)
+#define YAW (15)
+#define AUX1 (8)
+#define D7 (7)
+#define D4 (4)
+#define A0 (18)
+#define A1 (19)
+#define A2 (20)
+#define A3 (21)
+
+#define NONE (-1)
+
+#endif /* ROBOGEN_ARDUINO_HOST_H_ */
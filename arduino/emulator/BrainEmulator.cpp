@@ -0,0 +1,139 @@
+/*
+ * @(#) BrainEmulator.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * Runs the fixed-point brain generated for the Arduino next to the float
+ * one over recorded sensor values (sensorLog.txt of robogen-file-viewer),
+ * and reports how much their outputs deviate.
+ *
+ * Built and run by python/brain_emulator.py
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void floatBrainInit();
+void floatBrainStep(const float *input, float time, float *output);
+
+unsigned int fixedBrainInputs();
+unsigned int fixedBrainOutputs();
+unsigned int fixedBrainActuationPeriod();
+void fixedBrainInit();
+void fixedBrainStep(const float *input, float time, float *output);
+
+int main(int argc, char *argv[]) {
+
+	if (argc != 2) {
+		std::cerr << "usage: " << argv[0] << " <sensor log>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream sensorLog(argv[1]);
+	if (!sensorLog.is_open()) {
+		std::cerr << "Cannot open sensor log '" << argv[1] << "'"
+				<< std::endl;
+		return EXIT_FAILURE;
+	}
+
+	unsigned int nInputs = fixedBrainInputs();
+	unsigned int nOutputs = fixedBrainOutputs();
+	std::vector<float> input(nInputs + 1);
+	std::vector<float> floatOutput(nOutputs + 1);
+	std::vector<float> fixedOutput(nOutputs + 1);
+	std::vector<double> maxDeviation(nOutputs, 0.0);
+	std::vector<unsigned int> maxDeviationStep(nOutputs, 0);
+	std::vector<double> sumDeviation(nOutputs, 0.0);
+
+	floatBrainInit();
+	fixedBrainInit();
+
+	// the simulator steps the brain every actuation period
+	unsigned int nSteps = 0;
+	std::string line;
+	while (std::getline(sensorLog, line)) {
+		std::istringstream values(line);
+		unsigned int n = 0;
+		float value;
+		while (values >> value) {
+			if (n < nInputs) {
+				input[n] = value;
+			}
+			++n;
+		}
+		if (n == 0) {
+			continue;
+		}
+		if (n != nInputs) {
+			std::cerr << "Line " << (nSteps + 1) << " of the sensor log has "
+					<< n << " values, the brain has " << nInputs << " inputs"
+					<< std::endl;
+			return EXIT_FAILURE;
+		}
+
+		++nSteps;
+		float time = nSteps * fixedBrainActuationPeriod() / 1000.0f;
+		floatBrainStep(&input[0], time, &floatOutput[0]);
+		fixedBrainStep(&input[0], time, &fixedOutput[0]);
+
+		for (unsigned int i = 0; i < nOutputs; ++i) {
+			double deviation = std::fabs(fixedOutput[i] - floatOutput[i]);
+			sumDeviation[i] += deviation;
+			if (deviation > maxDeviation[i]) {
+				maxDeviation[i] = deviation;
+				maxDeviationStep[i] = nSteps;
+			}
+		}
+	}
+
+	if (nSteps == 0) {
+		std::cerr << "The sensor log is empty" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << nSteps << " steps, " << nInputs << " inputs, " << nOutputs
+			<< " outputs" << std::endl << std::endl;
+	std::cout << std::setw(8) << "output" << std::setw(16) << "max deviation"
+			<< std::setw(10) << "at step" << std::setw(16) << "mean deviation"
+			<< std::endl;
+	double overall = 0;
+	for (unsigned int i = 0; i < nOutputs; ++i) {
+		std::cout << std::setw(8) << i << std::setw(16) << maxDeviation[i]
+				<< std::setw(10) << maxDeviationStep[i] << std::setw(16)
+				<< sumDeviation[i] / nSteps << std::endl;
+		overall = std::max(overall, maxDeviation[i]);
+	}
+	std::cout << std::endl << "Maximum deviation: " << overall << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/*
+ * @(#) FixedBrain.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * The fixed-point brain generated for the Arduino (NeuralNetworkFixed.h)
+ */
+
+#include <stddef.h>
+
+#include "ArduinoHost.h"
+
+namespace fixedBrain {
+
+#include "NeuralNetworkFixed.h"
+
+NeuralNetwork network;
+
+}
+
+unsigned int fixedBrainInputs() {
+	return NB_INPUTS;
+}
+
+unsigned int fixedBrainOutputs() {
+	return NB_OUTPUTS;
+}
+
+unsigned int fixedBrainActuationPeriod() {
+	return ACTUATION_PERIOD;
+}
+
+void fixedBrainInit() {
+	fixedBrain::initNetwork(&fixedBrain::network, NB_INPUTS, NB_OUTPUTS,
+			NB_HIDDEN, NULL, NULL, NULL);
+}
+
+void fixedBrainStep(const float *input, float time, float *output) {
+	fixedBrain::feed(&fixedBrain::network, input);
+	fixedBrain::step(&fixedBrain::network, time);
+	fixedBrain::fetch(&fixedBrain::network, output);
+}
@@ -0,0 +1,58 @@
+/*
+ * @(#) FloatBrain.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * The float brain generated for the Arduino (NeuralNetwork.h), run by the
+ * simulator implementation of the network
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "ArduinoHost.h"
+
+namespace floatBrain {
+
+#include "NeuralNetwork.h"
+#include "brain/NeuralNetwork.c"
+
+NeuralNetwork network;
+
+}
+
+void floatBrainInit() {
+	floatBrain::initNetwork(&floatBrain::network, NB_INPUTS, NB_OUTPUTS,
+			NB_HIDDEN, floatBrain::EAWeight, floatBrain::EAParams,
+			floatBrain::EATypes);
+}
+
+void floatBrainStep(const float *input, float time, float *output) {
+	floatBrain::feed(&floatBrain::network, input);
+	floatBrain::step(&floatBrain::network, time);
+	floatBrain::fetch(&floatBrain::network, output);
+}
@@ -0,0 +1,119 @@
+/*
+ * @(#) racing_scenario_plugin.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * Native version of racing_scenario.js, built as a scenario plugin.
+ *
+ * Build it with add_robogen_scenario_plugin (src/cmake/RobogenScenarioPlugin.cmake)
+ * and point the 'scenario' parameter of the simulation configuration file to
+ * the resulting library, e.g.
+ *
+ * scenario=../build/racing_scenario_plugin.so
+ */
+
+#include <limits>
+#include <vector>
+#include <osg/Vec2>
+#include "config/RobogenConfig.h"
+#include "config/StartPositionConfig.h"
+#include "scenario/ScenarioPlugin.h"
+#include "Models.h"
+#include "Robot.h"
+
+namespace robogen {
+
+class RacingPluginScenario : public Scenario {
+
+public:
+
+	RacingPluginScenario(boost::shared_ptr<RobogenConfig> config) :
+		Scenario(config), curTrial_(0) {
+	}
+
+	virtual ~RacingPluginScenario() {
+	}
+
+	virtual bool setupSimulation() {
+		osg::Vec3 pos = getRobot()->getCoreComponent()->getRootPosition();
+		startPos_ = osg::Vec2(pos.x(), pos.y());
+		return true;
+	}
+
+	virtual bool afterSimulationStep() {
+		return true;
+	}
+
+	virtual bool endSimulation() {
+		// Compute robot ending position from its closest part to the origin
+		double minDistance = std::numeric_limits<double>::max();
+		const std::vector<boost::shared_ptr<Model> >& bodyParts =
+				getRobot()->getBodyParts();
+		for (unsigned int i = 0; i < bodyParts.size(); ++i) {
+			osg::Vec3 pos = bodyParts[i]->getRootPosition();
+			double dist = (osg::Vec2(pos.x(), pos.y()) - startPos_).length();
+			if (dist < minDistance) {
+				minDistance = dist;
+			}
+		}
+		distances_.push_back(minDistance);
+
+		curTrial_++;
+		setStartingPosition(curTrial_);
+		return true;
+	}
+
+	virtual double getFitness() {
+		// minimum distance travelled across evaluations
+		double fitness = distances_[0];
+		for (unsigned int i = 1; i < distances_.size(); ++i) {
+			if (distances_[i] < fitness)
+				fitness = distances_[i];
+		}
+		return fitness;
+	}
+
+	virtual bool remainingTrials() {
+		return curTrial_ < getRobogenConfig()->getStartingPos(
+				)->getStartPosition().size();
+	}
+
+	virtual int getCurTrial() const {
+		return curTrial_;
+	}
+
+private:
+
+	osg::Vec2 startPos_;
+	std::vector<double> distances_;
+	unsigned int curTrial_;
+
+};
+
+}
+
+ROBOGEN_SCENARIO_PLUGIN(robogen::RacingPluginScenario)
@@ -0,0 +1,43 @@
+{
+    // multi-objective version of racing_scenario.js, for selection=nsga2:
+    // travel far, with as few body parts as possible
+    distances : [],
+    setupSimulation: function() {
+	this.startPos = this.getRobot().getCoreComponent().getRootPosition();
+	return true;
+    },
+    endSimulation: function() {
+
+	// Compute robot ending position from its closest part to the origin
+	var minDistance = Number.MAX_VALUE;
+
+	bodyParts = this.getRobot().getBodyParts();
+	this.numBodyParts = bodyParts.length;
+	for (var i = 0; i < bodyParts.length; i++) {
+		var xDiff = (bodyParts[i].getRootPosition().x - this.startPos.x);
+		var yDiff = (bodyParts[i].getRootPosition().y - this.startPos.y);
+		var dist = Math.sqrt(Math.pow(xDiff,2) + Math.pow(yDiff,2));
+
+		if (dist < minDistance) {
+			minDistance = dist;
+		}
+	}
+
+	this.distances.push(minDistance);
+	return true;
+    },
+    // still required, it is what gets logged as the fitness
+    getFitness: function() {
+	fitness = this.distances[0];
+        for (var i=1; i<this.distances.length; i++) {
+		if (this.distances[i] < fitness)
+			fitness = this.distances[i];
+	}
+        return fitness;
+    },
+    // optional, all objectives are maximized
+    getObjectives: function() {
+	return [this.getFitness(), -this.numBodyParts];
+    },
+
+}
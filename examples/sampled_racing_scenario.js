@@ -0,0 +1,54 @@
+{
+    // only call afterSimulationStep every 100 steps
+    callbackInterval : 100,
+    // and hand it all the steps recorded in between, in one batch
+    recordSamples : true,
+
+    distances : [],
+    pathLength : 0,
+
+    setupSimulation: function() {
+	this.startPos = this.getRobot().getCoreComponent().getRootPosition();
+	this.lastPos = this.startPos;
+	this.pathLength = 0;
+	return true;
+    },
+
+    // samples.corePosition holds samples.count positions as [x0,y0,z0,x1,...]
+    afterSimulationStep: function(samples) {
+	this.accumulate(samples);
+	return true;
+    },
+
+    // endSimulation receives the steps recorded since the last callback
+    endSimulation: function(samples) {
+	this.accumulate(samples);
+	var xDiff = this.lastPos.x - this.startPos.x;
+	var yDiff = this.lastPos.y - this.startPos.y;
+	// reward straight paths: displacement relative to the distance walked
+	var displacement = Math.sqrt(xDiff * xDiff + yDiff * yDiff);
+	this.distances.push(displacement * displacement /
+			Math.max(this.pathLength, 1e-6));
+	return true;
+    },
+
+    accumulate: function(samples) {
+	var pos = samples.corePosition;
+	for (var i = 0; i < samples.count; i++) {
+		var x = pos[3 * i], y = pos[3 * i + 1];
+		this.pathLength += Math.sqrt(Math.pow(x - this.lastPos.x, 2) +
+				Math.pow(y - this.lastPos.y, 2));
+		this.lastPos = {x : x, y : y};
+	}
+    },
+
+    getFitness: function() {
+	fitness = this.distances[0];
+	for (var i=1; i<this.distances.length; i++) {
+		if (this.distances[i] < fitness)
+			fitness = this.distances[i];
+	}
+	return fitness;
+    },
+
+}
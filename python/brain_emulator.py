@@ -0,0 +1,54 @@
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Compiles the fixed-point Arduino brain (NeuralNetworkFixed.h) generated by
+# robogen-file-viewer on the host, runs it next to the float brain
+# (NeuralNetwork.h) over the recorded sensor values, and reports the
+# deviation of their outputs.
+#
+# usage: python brain_emulator.py <FileViewer results dir> [<sensor log>]
+#
+# The sensor log defaults to sensorLog.txt in the results directory; the
+# compiler can be chosen with the CXX environment variable.
+
+ROBOGEN_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+EMULATOR_DIR = os.path.join(ROBOGEN_DIR, "arduino", "emulator")
+SOURCES = ["BrainEmulator.cpp", "FloatBrain.cpp", "FixedBrain.cpp"]
+
+
+def build(results_dir, out_file) :
+    compiler = os.environ.get("CXX", "c++")
+    command = [compiler, "-O2", "-o", out_file,
+               "-I" + os.path.abspath(results_dir),
+               "-I" + EMULATOR_DIR,
+               "-I" + os.path.join(ROBOGEN_DIR, "src")]
+    command += [os.path.join(EMULATOR_DIR, source) for source in SOURCES]
+    subprocess.check_call(command)
+
+
+if __name__ == "__main__" :
+    if len(sys.argv) < 2 :
+        print("usage: python brain_emulator.py <FileViewer results dir> "
+              "[<sensor log>]")
+        sys.exit(1)
+
+    results_dir = sys.argv[1]
+    sensor_log = os.path.join(results_dir, "sensorLog.txt")
+    if len(sys.argv) > 2 :
+        sensor_log = sys.argv[2]
+
+    for header in ["NeuralNetwork.h", "NeuralNetworkFixed.h"] :
+        if not os.path.exists(os.path.join(results_dir, header)) :
+            print("%s not found in %s" % (header, results_dir))
+            sys.exit(1)
+
+    build_dir = tempfile.mkdtemp()
+    try :
+        emulator = os.path.join(build_dir, "brain-emulator")
+        build(results_dir, emulator)
+        sys.exit(subprocess.call([emulator, sensor_log]))
+    finally :
+        shutil.rmtree(build_dir)
@@ -0,0 +1,29 @@
+import struct
+import sys
+
+from PIL import Image
+
+# Converts an image to a raw (memory mappable) height map, see
+# src/scenario/HeightMap.h for the format.
+#
+# usage: python heightmap_converter.py height_field.jpg height_field.hmap
+
+
+def convert(input_file, output_file) :
+    image = Image.open(input_file).convert("L")
+    cols, rows = image.size
+    pixels = image.load()
+    with open(output_file, "wb") as output :
+        # magic, version, columns, rows, sample type (0: bytes)
+        output.write(b"RHMP")
+        output.write(struct.pack("<IIII", 1, cols, rows, 0))
+        # rows start at the maximum y, i.e. the top of the image
+        for y in range(rows) :
+            output.write(bytes(bytearray(pixels[x, y] for x in range(cols))))
+
+
+if __name__ == "__main__" :
+    if len(sys.argv) != 3 :
+        print("usage: python heightmap_converter.py <image> <output.hmap>")
+        sys.exit(1)
+    convert(sys.argv[1], sys.argv[2])
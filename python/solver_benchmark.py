@@ -0,0 +1,134 @@
+import glob
+import os
+import re
+import subprocess
+import sys
+import time
+
+# Compares the exact ODE solver (dWorldStep) with the iterative one
+# (dWorldQuickStep) by running the example robots under both, and reports
+# the fitness deviation and the simulation throughput of each solver.
+#
+# usage: python solver_benchmark.py <robogen-file-viewer> <examples dir>
+#            [<simulator conf>] [<quickstep iterations> ...]
+#
+# The simulator configuration defaults to conf.txt in the examples
+# directory; the iterations to test default to 10 20 40.
+
+FITNESS_REGEX = re.compile(r"Fitness for the current solution: (\S+)")
+
+
+def find_robots(examples_dir) :
+    robots = []
+    for robot_file in sorted(glob.glob(os.path.join(examples_dir, "*.txt")) +
+                             glob.glob(os.path.join(examples_dir, "*.json"))) :
+        # robot text files start with the core component line
+        with open(robot_file) as f :
+            first_line = f.readline().strip()
+        if robot_file.endswith(".json") or first_line.startswith("0 Core") :
+            robots.append(robot_file)
+    return robots
+
+
+def read_conf_steps(conf_file) :
+    steps = None
+    time_step = None
+    simulation_time = None
+    with open(conf_file) as f :
+        for line in f :
+            key, _, value = line.partition("=")
+            key = key.strip()
+            if key == "nTimeSteps" :
+                steps = int(value)
+            elif key == "timeStep" :
+                time_step = float(value)
+            elif key == "simulationTime" :
+                simulation_time = float(value)
+    if steps is None :
+        steps = int(round(simulation_time / time_step))
+    return steps
+
+
+def write_conf(conf_file, solver_options) :
+    # written next to the original so relative paths still resolve
+    out_file = os.path.join(os.path.dirname(os.path.abspath(conf_file)),
+                            ".solver_benchmark_conf.txt")
+    with open(conf_file) as f :
+        lines = [line for line in f
+                 if line.partition("=")[0].strip() not in
+                 ("solver", "quickStepIterations", "quickStepSOR")]
+    with open(out_file, "w") as f :
+        f.writelines(lines)
+        f.write("\n")
+        for key, value in solver_options :
+            f.write("%s=%s\n" % (key, value))
+    return out_file
+
+
+def run(viewer, robot, conf) :
+    start = time.time()
+    output = subprocess.check_output([viewer, robot, conf,
+                                      "--no-visualization", "--seed", "1"],
+                                     stderr=subprocess.STDOUT)
+    elapsed = time.time() - start
+    match = FITNESS_REGEX.search(output.decode("utf-8", "replace"))
+    if match is None :
+        raise RuntimeError("no fitness reported for " + robot)
+    return float(match.group(1)), elapsed
+
+
+if __name__ == "__main__" :
+    if len(sys.argv) < 3 :
+        print("usage: python solver_benchmark.py <robogen-file-viewer> "
+              "<examples dir> [<simulator conf>] [<iterations> ...]")
+        sys.exit(1)
+
+    viewer = sys.argv[1]
+    examples_dir = sys.argv[2]
+    conf_file = os.path.join(examples_dir, "conf.txt")
+    if len(sys.argv) > 3 :
+        conf_file = sys.argv[3]
+    iterations = [int(i) for i in sys.argv[4:]] or [10, 20, 40]
+
+    robots = find_robots(examples_dir)
+    steps = read_conf_steps(conf_file)
+
+    solvers = [("step", [("solver", "step")])]
+    for i in iterations :
+        solvers.append(("quickstep-%d" % i, [("solver", "quickstep"),
+                                             ("quickStepIterations", i)]))
+
+    fitness = {}
+    elapsed = {}
+    conf = None
+    try :
+        for name, options in solvers :
+            conf = write_conf(conf_file, options)
+            for robot in robots :
+                fitness[name, robot], elapsed[name, robot] = run(viewer, robot,
+                                                                  conf)
+    finally :
+        if conf is not None and os.path.exists(conf) :
+            os.remove(conf)
+
+    print("%-28s %-14s %12s %12s %12s" % ("robot", "solver", "fitness",
+                                          "deviation", "steps/s"))
+    for robot in robots :
+        reference = fitness["step", robot]
+        for name, _ in solvers :
+            f = fitness[name, robot]
+            print("%-28s %-14s %12.5f %12.5f %12.0f" % (
+                os.path.basename(robot), name, f, abs(f - reference),
+                steps / elapsed[name, robot]))
+
+    print("")
+    print("%-14s %16s %16s %12s" % ("solver", "mean deviation", "max deviation",
+                                    "speedup"))
+    total_step_time = sum(elapsed["step", robot] for robot in robots)
+    for name, _ in solvers :
+        deviations = [abs(fitness[name, robot] - fitness["step", robot])
+                      for robot in robots]
+        total_time = sum(elapsed[name, robot] for robot in robots)
+        print("%-14s %16.5f %16.5f %11.2fx" % (
+            name, sum(deviations) / len(deviations), max(deviations),
+            total_step_time / total_time))
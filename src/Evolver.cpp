@@ -27,6 +27,8 @@
  * @(#) $Id$
  */
 
+#include <algorithm>
+#include <cmath>
 #include <boost/shared_ptr.hpp>
 #include <boost/lexical_cast.hpp>
 #include "config/EvolverConfiguration.h"
@@ -35,9 +37,20 @@
 #include "evolution/engine/Population.h"
 #include "evolution/engine/Selector.h"
 #include "evolution/engine/Mutator.h"
+#include "evolution/engine/Surrogate.h"
+#include "evolution/engine/IslandMigration.h"
+#include "evolution/engine/MapElites.h"
+#include "evolution/engine/Evaluator.h"
+#include "evolution/engine/evaluators/SocketEvaluator.h"
+#include "evolution/engine/evaluators/LocalEvaluator.h"
 #include "evolution/engine/selectors/DeterministicTournament.h"
+#include "evolution/engine/selectors/Nsga2.h"
+#include "evolution/engine/selectors/LinearRank.h"
+#include "evolution/engine/selectors/StochasticUniversalSampling.h"
+#include "evolution/engine/selectors/Truncation.h"
 
 #include "evolution/engine/neat/NeatContainer.h"
+#include "evolution/engine/cmaes/CmaesOptimizer.h"
 
 #ifdef EMSCRIPTEN
 #include <emscripten/bind.h>
@@ -46,6 +59,18 @@
 #include <sstream>
 #endif
 
+#ifdef QT5_ENABLED
+#include <QCoreApplication>
+#endif
+
+#ifndef EMSCRIPTEN
+// ODE World of in-process simulations
+thread_local dWorldID odeWorld;
+
+// Container for collisions of in-process simulations
+thread_local dJointGroupID odeContactGroup;
+#endif
+
 namespace robogen {
 void init(unsigned int seed, std::string outputDirectory,
 		std::string confFileName, bool overwrite, bool saveAll);
@@ -87,16 +112,26 @@ void printHelp() {
 boost::shared_ptr<Population> population;
 IndividualContainer children;
 boost::shared_ptr<NeatContainer> neatContainer;
+boost::shared_ptr<CmaesOptimizer> cmaes;
 boost::shared_ptr<RobogenConfig> robotConf;
 boost::shared_ptr<EvolverConfiguration> conf;
 boost::shared_ptr<EvolverLog> log;
 bool neat;
 boost::shared_ptr<Selector> selector;
 boost::shared_ptr<Mutator> mutator;
+boost::shared_ptr<Surrogate> surrogate;
+// features and predicted fitness of the offspring kept by the surrogate
+std::vector<std::vector<double> > offspringFeatures;
+std::vector<double> offspringPredictions;
 unsigned int generation;
 boost::random::mt19937 rng;
 
 std::vector<Socket*> sockets;
+boost::shared_ptr<Evaluator> evaluator;
+#ifndef EMSCRIPTEN
+boost::shared_ptr<IslandMigration> migration;
+boost::shared_ptr<MapElites> mapElites;
+#endif
 
 void parseArgsThenInit(int argc, char* argv[]) {
 
@@ -178,6 +213,14 @@ void init(unsigned int seed, std::string outputDirectory,
 
 	if (conf->selection == conf->DETERMINISTIC_TOURNAMENT) {
 		selector.reset(new DeterministicTournament(conf->tournamentSize, rng));
+	} else if (conf->selection == conf->NSGA2) {
+		selector.reset(new Nsga2(conf->tournamentSize, rng));
+	} else if (conf->selection == conf->LINEAR_RANK) {
+		selector.reset(new LinearRank(conf->rankPressure, rng));
+	} else if (conf->selection == conf->STOCHASTIC_UNIVERSAL_SAMPLING) {
+		selector.reset(new StochasticUniversalSampling(rng));
+	} else if (conf->selection == conf->TRUNCATION) {
+		selector.reset(new Truncation(conf->truncationFraction, rng));
 	} else {
 		std::cerr << "Selection type id " << conf->selection << " unknown."
 				<< std::endl;
@@ -185,6 +228,9 @@ void init(unsigned int seed, std::string outputDirectory,
 	}
 
 	mutator.reset(new Mutator(conf, rng));
+	if (conf->surrogateOversampling > 1) {
+		surrogate.reset(new Surrogate(conf->surrogateHistory));
+	}
 	log.reset(new EvolverLog());
 	try {
 		if (!log->init(conf, robotConf, outputDirectory, overwrite, saveAll)) {
@@ -228,9 +274,12 @@ void init(unsigned int seed, std::string outputDirectory,
 	}
 
 	neat = (conf->evolutionaryAlgorithm == EvolverConfiguration::HYPER_NEAT);
+	// with CMA-ES the population holds the lambda samples of a generation
+	bool useCmaes = (conf->evolutionaryAlgorithm ==
+			EvolverConfiguration::CMAES);
 	population.reset(new Population());
-	if (!population->init(referenceBot, conf->mu, mutator, growBodies,
-			(!(conf->useBrainSeed || neat)) ) ) {
+	if (!population->init(referenceBot, useCmaes ? conf->lambda : conf->mu,
+			mutator, growBodies, (!(conf->useBrainSeed || neat)) ) ) {
 		std::cerr << "Error when initializing population!" << std::endl;
 		exitRobogen(EXIT_FAILURE);
 	}
@@ -239,6 +288,10 @@ void init(unsigned int seed, std::string outputDirectory,
 		neatContainer.reset(new NeatContainer(conf, population, seed, rng));
 	}
 
+	if (useCmaes) {
+		cmaes.reset(new CmaesOptimizer(conf, rng));
+	}
+
 	// ---------------------------------------
 	// open sockets for communication with simulator processes
 	// ---------------------------------------
@@ -255,6 +308,45 @@ void init(unsigned int seed, std::string outputDirectory,
 		}
 #endif
 	}
+
+	if (conf->evaluationThreads > 0) {
+		std::cout << "Simulating individuals in-process on "
+				<< conf->evaluationThreads << " threads" << std::endl;
+		if (conf->evaluationThreads > 1 &&
+				robotConf->getSolver() == RobogenConfig::QUICKSTEP_SOLVER) {
+			std::cout << "WARNING: quickstep draws from the process-wide "
+					<< "ODE random generator, fitness is not reproducible "
+					<< "when individuals are simulated in parallel. Use "
+					<< "solver=step or evaluationThreads=1 for reproducible "
+					<< "results." << std::endl;
+		}
+		evaluator.reset(new LocalEvaluator(conf->evaluationThreads, seed));
+	} else {
+		evaluator.reset(new SocketEvaluator(sockets));
+	}
+
+	if (conf->islandPort != 0 || !conf->migrationTargets.empty()) {
+		migration.reset(new IslandMigration(conf));
+		if (!migration->init()) {
+			exitRobogen(EXIT_FAILURE);
+		}
+	}
+
+	if (conf->evolutionaryAlgorithm == EvolverConfiguration::MAP_ELITES) {
+		mapElites.reset(new MapElites(conf, log, rng));
+		if (conf->mapElitesArchive.compare("") != 0 &&
+				!mapElites->resume(conf->mapElitesArchive)) {
+			exitRobogen(EXIT_FAILURE);
+		}
+		mapElites->setInitialPopulation(population);
+	}
+#else
+	if (conf->evolutionaryAlgorithm == EvolverConfiguration::MAP_ELITES) {
+		std::cerr << "MAP-Elites is not available in the javascript build"
+				<< std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+	evaluator.reset(new SocketEvaluator(sockets));
 #endif
 
 	// ---------------------------------------
@@ -268,8 +360,21 @@ void init(unsigned int seed, std::string outputDirectory,
 		}
 	}
 
+	if (cmaes) {
+		if (!cmaes->fillPopulationWeights(population)) {
+			std::cerr << "Initializing CMA-ES failed." << std::endl;
+			exitRobogen(EXIT_FAILURE);
+		}
+	}
+
 	generation = 1;
-	population->evaluate(robotConf, sockets);
+#ifndef EMSCRIPTEN
+	// MAP-Elites streams individuals to the evaluator instead
+	if (mapElites) {
+		return;
+	}
+#endif
+	population->evaluate(robotConf, *evaluator, conf);
 }
 
 void mainEvolutionLoop();
@@ -279,13 +384,101 @@ void postEvaluateNEAT() {
 	mainEvolutionLoop();
 }
 
+/**
+ * Train the surrogate on the real fitness of the offspring it kept, and log
+ * how well it predicted them
+ */
+void updateSurrogate() {
+
+	unsigned int predicted = 0;
+	double absError = 0, sumP = 0, sumF = 0, sumPP = 0, sumFF = 0, sumPF = 0;
+	for (unsigned int i = 0; i < offspringFeatures.size(); ++i) {
+		// low fidelity fitness is not on the same scale
+		if (children[i]->isLowFidelity()) {
+			continue;
+		}
+		double fitness = children[i]->getFitness();
+		surrogate->addSample(offspringFeatures[i], fitness);
+		if (!offspringPredictions.empty()) {
+			double prediction = offspringPredictions[i];
+			++predicted;
+			absError += std::fabs(prediction - fitness);
+			sumP += prediction;
+			sumF += fitness;
+			sumPP += prediction * prediction;
+			sumFF += fitness * fitness;
+			sumPF += prediction * fitness;
+		}
+	}
+
+	if (predicted > 0) {
+		double covariance = sumPF / predicted -
+				(sumP / predicted) * (sumF / predicted);
+		double varianceP = sumPP / predicted -
+				(sumP / predicted) * (sumP / predicted);
+		double varianceF = sumFF / predicted -
+				(sumF / predicted) * (sumF / predicted);
+		double correlation = 0;
+		if (varianceP > 0 && varianceF > 0) {
+			correlation = covariance / std::sqrt(varianceP * varianceF);
+		}
+		if (!log->logSurrogate(generation, surrogate->getNumSamples(),
+				predicted, absError / predicted, correlation)) {
+			exitRobogen(EXIT_FAILURE);
+		}
+	}
+
+	surrogate->train();
+}
+
+/**
+ * Reduce the candidate offspring to the lambda the surrogate predicts best
+ * (the first lambda while it is not trained yet)
+ * @param parentFitness mean fitness of the parents of each candidate
+ */
+void screenOffspring(const std::vector<double> &parentFitness) {
+
+	std::vector<std::vector<double> > features(children.size());
+	std::vector<std::pair<double, unsigned int> > ranking;
+	for (unsigned int i = 0; i < children.size(); ++i) {
+		features[i] = Surrogate::getFeatures(children[i], parentFitness[i]);
+		ranking.push_back(std::make_pair(surrogate->isTrained() ?
+				-surrogate->predict(features[i]) : i, i));
+	}
+	std::sort(ranking.begin(), ranking.end());
+
+	IndividualContainer screened;
+	offspringFeatures.clear();
+	offspringPredictions.clear();
+	for (unsigned int k = 0; k < conf->lambda; ++k) {
+		unsigned int i = ranking[k].second;
+		screened.push_back(children[i]);
+		offspringFeatures.push_back(features[i]);
+		if (surrogate->isTrained()) {
+			offspringPredictions.push_back(-ranking[k].first);
+		}
+	}
+	std::cout << "Surrogate kept " << screened.size() << " of "
+			<< children.size() << " candidate offspring" << std::endl;
+	children = screened;
+}
+
 void postEvaluateStd() {
 
+	if (surrogate) {
+		updateSurrogate();
+	}
+
 	// comma or plus?
 	if (conf->replacement == conf->PLUS_REPLACEMENT) {
 		children += *population.get();
 	}
 
+	// multi-objective: keep the mu best by front and crowding distance
+	if (conf->selection == conf->NSGA2) {
+		Nsga2::reduce(children, conf->mu);
+	}
+
 	// replace
 	population.reset(new Population());
 	if (!population->init(children, conf->mu)) {
@@ -299,7 +492,8 @@ void triggerPostEvaluate() {
 	if (generation == 1) {
 		mainEvolutionLoop();
 	} else {
-		if (neat) {
+		if (neat || cmaes) {
+			// the population was replaced in place
 			postEvaluateNEAT();
 		} else {
 			postEvaluateStd();
@@ -321,6 +515,21 @@ void mainEvolutionLoop() {
 	if (!log->logGeneration(generation, *population.get())) {
 		exitRobogen(EXIT_FAILURE);
 	}
+#ifndef EMSCRIPTEN
+	// the individuals simulated for this generation are the offspring,
+	// except for the initial population and with NEAT or CMA-ES
+	if (!log->logProfile(generation, (generation == 1 || neat || cmaes) ?
+			population->getProfile() : children.getProfile())) {
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	// exchange individuals with the other islands
+	if (migration && !neat && generation % conf->migrationInterval == 0 &&
+			generation < conf->numGenerations) {
+		migration->emigrate(*population.get(), generation);
+		migration->immigrate(*population.get());
+	}
+#endif
 
 	generation++;
 
@@ -337,12 +546,25 @@ void mainEvolutionLoop() {
 						<< std::endl;
 				exitRobogen(EXIT_FAILURE);
 			}
-			population->evaluate(robotConf, sockets);
+			population->evaluate(robotConf, *evaluator, conf);
+
+		} else if (cmaes) {
+			if (!cmaes->produceNextGeneration(population)) {
+				std::cerr << "Producing next generation from CMA-ES failed."
+						<< std::endl;
+				exitRobogen(EXIT_FAILURE);
+			}
+			population->evaluate(robotConf, *evaluator, conf);
 
 		} else {
 			selector->initPopulation(population);
+			unsigned int numCandidates = conf->lambda;
+			if (surrogate) {
+				numCandidates *= conf->surrogateOversampling;
+			}
+			std::vector<double> parentFitness;
 			unsigned int numOffspring = 0;
-			while (numOffspring < conf->lambda) {
+			while (numOffspring < numCandidates) {
 
 				std::pair<boost::shared_ptr<RobotRepresentation>,
 						boost::shared_ptr<RobotRepresentation> > selection;
@@ -368,8 +590,13 @@ void mainEvolutionLoop() {
 					= mutator->createOffspring(selection.first,
 											   selection.second);
 
+				double meanParentFitness = (offspring.size() > 1) ?
+						(selection.first->getFitness() +
+						selection.second->getFitness()) / 2 :
+						selection.first->getFitness();
+
 				// no crossover, or can fit both new individuals
-				if ( (numOffspring + offspring.size()) <= conf->lambda ) {
+				if ( (numOffspring + offspring.size()) <= numCandidates ) {
 					children.insert(children.end(), offspring.begin(),
 													offspring.end() );
 					numOffspring += offspring.size();
@@ -377,8 +604,12 @@ void mainEvolutionLoop() {
 					children.push_back(offspring[0]);
 					numOffspring++;
 				}
+				parentFitness.resize(children.size(), meanParentFitness);
 			}
-			children.evaluate(robotConf, sockets);
+			if (surrogate) {
+				screenOffspring(parentFitness);
+			}
+			children.evaluate(robotConf, *evaluator, conf);
 		}
 #ifndef EMSCRIPTEN
 		triggerPostEvaluate();
@@ -408,8 +639,20 @@ using namespace robogen;
 
 #ifndef EMSCRIPTEN
 int main(int argc, char *argv[]) {
+#ifdef QT5_ENABLED
+QCoreApplication a(argc, argv);
+#endif
 parseArgsThenInit(argc, argv);
-triggerPostEvaluate();
+if (mapElites) {
+	std::cout << mapElites->getBudget() << " individuals queued for "
+			<< "evaluation into the MAP-Elites archive. Progress:"
+			<< std::endl;
+	evaluator->evaluate(*mapElites, robotConf);
+	mapElites->finish();
+} else {
+	triggerPostEvaluate();
+}
+evaluator.reset();
 // Clean up sockets
 for (unsigned int i = 0; i < conf->sockets.size(); i++) {
 	delete sockets[i];
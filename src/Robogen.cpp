@@ -30,6 +30,8 @@
 #include "robogen.pb.h"
 #ifdef EMSCRIPTEN
 #include  "utils/JSUtils.h"
+#else
+#include "utils/OdeThreadPool.h"
 #endif
 
 namespace robogen {
@@ -86,6 +88,9 @@ void startRobogen() {
 }
 
 void exitRobogen(int exitCode) {
+#ifndef EMSCRIPTEN
+	OdeThreadPool::shutdown();
+#endif
 	google::protobuf::ShutdownProtobufLibrary();
 #ifdef EMSCRIPTEN
 	if (exitCode == EXIT_FAILURE) {
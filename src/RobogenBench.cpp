@@ -0,0 +1,510 @@
+/*
+ * @(#) RobogenBench.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <streambuf>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <jansson.h>
+
+#include "config/ConfigurationReader.h"
+#include "config/EvolverConfiguration.h"
+#include "config/RobogenConfig.h"
+#include "evolution/engine/BodyVerifier.h"
+#include "evolution/engine/Mutator.h"
+#include "evolution/neat/Genome.h"
+#include "evolution/neat/Population.h"
+#include "evolution/representation/RobotRepresentation.h"
+#include "scenario/Scenario.h"
+#include "scenario/ScenarioFactory.h"
+#include "utils/SimulationProfile.h"
+#include "Robogen.h"
+#include "Robot.h"
+#include "robogen.pb.h"
+
+#include "Simulator.h"
+
+#ifdef QT5_ENABLED
+#include <QCoreApplication>
+#endif
+
+/**
+ * Headless throughput benchmark: simulates a fixed corpus of the example
+ * robots and configurations, and times the hot spots of evolution, then
+ * prints a JSON report.
+ */
+
+// ---------------------------------------
+// Allocation counting
+// ---------------------------------------
+
+namespace {
+
+std::atomic<unsigned long long> allocationCount(0);
+
+}
+
+void *operator new(std::size_t size) {
+	++allocationCount;
+	void *p = std::malloc(size ? size : 1);
+	if (p == NULL) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void *operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+	std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+	std::free(p);
+}
+
+using namespace robogen;
+
+// ODE World
+thread_local dWorldID odeWorld;
+
+// Container for collisions
+thread_local dJointGroupID odeContactGroup;
+
+#define BENCH_SEED 42
+#define EVOLUTION_CONF "evolConf-full.txt"
+
+namespace {
+
+/**
+ * Robot and simulator configuration of the corpus, relative to the examples
+ * directory
+ */
+const char *CORPUS[][2] = {
+		{ "starfish.txt", "conf.txt" },
+		{ "cart.txt", "conf.txt" },
+		{ "cartWithSensors.txt", "conf.txt" },
+		{ "walkingStarfish.json", "conf.txt" },
+		{ "cartWithSensors.txt", "confObstacleAvoidance.txt" },
+		{ "starfish.txt", "conf-height_field.txt" }
+};
+
+/**
+ * Robots used by the evolution microbenchmarks
+ */
+const char *MICRO_ROBOTS[] = { "starfish.txt", "cart.txt",
+		"cartWithSensors.txt" };
+
+/**
+ * Swallows the simulator progress output, so that only the report is
+ * printed on the standard output
+ */
+class NullBuffer : public std::streambuf {
+protected:
+	virtual int overflow(int c) {
+		return c;
+	}
+};
+
+typedef SimulationProfile::Clock Clock;
+
+double secondsSince(const Clock::time_point &start) {
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+json_t *microResult(const std::string &name, unsigned int iterations,
+		double seconds, unsigned long long allocations) {
+	json_t *result = json_object();
+	json_object_set_new(result, "name", json_string(name.c_str()));
+	json_object_set_new(result, "iterations", json_integer(iterations));
+	json_object_set_new(result, "seconds", json_real(seconds));
+	json_object_set_new(result, "perSecond",
+			json_real(seconds > 0 ? iterations / seconds : 0));
+	json_object_set_new(result, "allocations", json_integer(allocations));
+	return result;
+}
+
+json_t *profileJson(const SimulationProfile &profile) {
+	json_t *phases = json_object();
+	for (unsigned int i = 0; i < SimulationProfile::NUM_PHASES; ++i) {
+		json_t *phase = json_object();
+		json_object_set_new(phase, "seconds", json_real(profile.getSeconds(i)));
+		json_object_set_new(phase, "calls", json_integer(profile.getCalls(i)));
+		json_object_set_new(phases, SimulationProfile::getPhaseName(i), phase);
+	}
+	return phases;
+}
+
+/**
+ * Simulates one corpus entry repetitions times
+ * @return the entry report, or NULL if the entry could not be run
+ */
+json_t *benchSimulation(const std::string &examplesDir,
+		const std::string &robotFile, const std::string &confFile,
+		unsigned int repetitions, SimulationProfile &totalProfile,
+		double &totalSeconds) {
+
+	boost::shared_ptr<RobogenConfig> configuration =
+			ConfigurationReader::parseConfigurationFile(
+					examplesDir + "/" + confFile);
+	if (!configuration) {
+		std::cerr << "Skipping " << robotFile << " with " << confFile
+				<< ": cannot parse configuration" << std::endl;
+		return NULL;
+	}
+
+	robogenMessage::Robot robotMessage;
+	if (!RobotRepresentation::createRobotMessageFromFile(robotMessage,
+			examplesDir + "/" + robotFile)) {
+		std::cerr << "Skipping " << robotFile << " with " << confFile
+				<< ": cannot load robot" << std::endl;
+		return NULL;
+	}
+
+	boost::random::mt19937 rng(BENCH_SEED);
+	SimulationProfile profile;
+	double fitness = 0;
+	unsigned long long allocations = allocationCount;
+	Clock::time_point start = Clock::now();
+
+	for (unsigned int i = 0; i < repetitions; ++i) {
+		boost::shared_ptr<Scenario> scenario =
+				ScenarioFactory::createScenario(configuration);
+		if (!scenario) {
+			std::cerr << "Skipping " << robotFile << " with " << confFile
+					<< ": cannot create scenario" << std::endl;
+			return NULL;
+		}
+		unsigned int result = runSimulations(scenario, configuration,
+				robotMessage, NULL, rng, false,
+				boost::shared_ptr<FileViewerLog>(), profile);
+		if (result == SIMULATION_FAILURE) {
+			std::cerr << "Skipping " << robotFile << " with " << confFile
+					<< ": simulation failed" << std::endl;
+			return NULL;
+		}
+		fitness = (result == CONSTRAINT_VIOLATED) ? MIN_FITNESS :
+				scenario->getFitness();
+	}
+
+	double seconds = secondsSince(start);
+	allocations = allocationCount - allocations;
+
+	totalProfile.merge(profile);
+	totalSeconds += seconds;
+
+	json_t *entry = json_object();
+	json_object_set_new(entry, "robot", json_string(robotFile.c_str()));
+	json_object_set_new(entry, "configuration", json_string(confFile.c_str()));
+	json_object_set_new(entry, "repetitions", json_integer(repetitions));
+	json_object_set_new(entry, "fitness", json_real(fitness));
+	json_object_set_new(entry, "seconds", json_real(seconds));
+	json_object_set_new(entry, "steps", json_integer(profile.getSteps()));
+	json_object_set_new(entry, "stepsPerSecond",
+			json_real(profile.getSteps() / seconds));
+	json_object_set_new(entry, "evaluationsPerSecond",
+			json_real(repetitions / seconds));
+	json_object_set_new(entry, "allocations", json_integer(allocations));
+	json_object_set_new(entry, "allocationsPerStep", json_real(
+			profile.getSteps() ? (double) allocations / profile.getSteps() : 0));
+	json_object_set_new(entry, "contacts", json_integer(profile.getContacts()));
+	json_object_set_new(entry, "maxContacts",
+			json_integer(profile.getMaxContacts()));
+	json_object_set_new(entry, "phases", profileJson(profile));
+	return entry;
+}
+
+json_t *benchBodyVerifier(
+		const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+		unsigned int iterations) {
+	unsigned long long allocations = allocationCount;
+	Clock::time_point start = Clock::now();
+	for (unsigned int i = 0; i < iterations; ++i) {
+		int errorCode;
+		std::vector<std::pair<std::string, std::string> > affectedBodyParts;
+		BodyVerifier::verify(*robots[i % robots.size()], errorCode,
+				affectedBodyParts, false);
+	}
+	double seconds = secondsSince(start);
+	return microResult("BodyVerifier::verify", iterations, seconds,
+			allocationCount - allocations);
+}
+
+json_t *benchMutator(const std::string &examplesDir,
+		const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+		unsigned int iterations) {
+	boost::shared_ptr<EvolverConfiguration> conf(new EvolverConfiguration());
+	if (!conf->init(examplesDir + "/" + EVOLUTION_CONF)) {
+		std::cerr << "Skipping Mutator::createOffspring: cannot parse "
+				<< EVOLUTION_CONF << std::endl;
+		return NULL;
+	}
+	boost::random::mt19937 rng(BENCH_SEED);
+	Mutator mutator(conf, rng);
+
+	unsigned long long allocations = allocationCount;
+	Clock::time_point start = Clock::now();
+	for (unsigned int i = 0; i < iterations; ++i) {
+		mutator.createOffspring(robots[i % robots.size()],
+				robots[(i + 1) % robots.size()]);
+	}
+	double seconds = secondsSince(start);
+	return microResult("Mutator::createOffspring", iterations, seconds,
+			allocationCount - allocations);
+}
+
+json_t *benchNeatEpoch(unsigned int iterations) {
+	NEAT::Parameters params;
+	// same CPPN as the NeatContainer: (x1, y1, io1, x2, y2, io2, bias) to
+	// (connection exists, weight, params)
+	NEAT::Population population(NEAT::Genome(0, 7, 0, 5, false,
+			NEAT::UNSIGNED_SIGMOID, NEAT::UNSIGNED_SIGMOID, 0, params),
+			params, true, 1.0, BENCH_SEED);
+	boost::random::mt19937 rng(BENCH_SEED);
+	boost::random::uniform_real_distribution<double> fitness(0, 1);
+
+	unsigned long long allocations = allocationCount;
+	Clock::time_point start = Clock::now();
+	for (unsigned int i = 0; i < iterations; ++i) {
+		for (unsigned int j = 0; j < population.m_Species.size(); ++j) {
+			for (unsigned int k = 0;
+					k < population.m_Species[j].m_Individuals.size(); ++k) {
+				population.m_Species[j].m_Individuals[k].SetFitness(
+						fitness(rng));
+			}
+		}
+		population.Epoch();
+	}
+	double seconds = secondsSince(start);
+	return microResult("NEAT::Population::Epoch", iterations, seconds,
+			allocationCount - allocations);
+}
+
+json_t *benchNeuralNetwork(unsigned int iterations) {
+	const unsigned int nInputs = MAX_INPUT_NEURONS;
+	const unsigned int nOutputs = MAX_OUTPUT_NEURONS;
+	const unsigned int nHidden = MAX_HIDDEN_NEURONS;
+	const unsigned int nNonInputs = nOutputs + nHidden;
+
+	boost::random::mt19937 rng(BENCH_SEED);
+	boost::random::uniform_real_distribution<float> dist(-1, 1);
+
+	std::vector<float> weights((nInputs + nNonInputs) * nNonInputs);
+	for (unsigned int i = 0; i < weights.size(); ++i) {
+		weights[i] = dist(rng);
+	}
+	// (bias, tau, gain)
+	std::vector<float> params(nNonInputs * MAX_PARAMS);
+	std::vector<unsigned int> types(nNonInputs);
+	for (unsigned int i = 0; i < nNonInputs; ++i) {
+		params[i * MAX_PARAMS] = dist(rng);
+		params[i * MAX_PARAMS + 1] = 1.0;
+		params[i * MAX_PARAMS + 2] = 1.0;
+		types[i] = (i < nOutputs) ? SIGMOID : CTRNN_SIGMOID;
+	}
+
+	NeuralNetwork network;
+	initNetwork(&network, nInputs, nOutputs, nHidden, &weights[0],
+			&params[0], &types[0]);
+
+	float input[MAX_INPUT_NEURONS];
+	float output[MAX_OUTPUT_NEURONS];
+	for (unsigned int i = 0; i < nInputs; ++i) {
+		input[i] = dist(rng);
+	}
+
+	float checksum = 0;
+	Clock::time_point start = Clock::now();
+	for (unsigned int i = 0; i < iterations; ++i) {
+		::feed(&network, input);
+		::step(&network, i * 0.01);
+		::fetch(&network, output);
+		checksum += output[0];
+	}
+	double seconds = secondsSince(start);
+	json_t *result = microResult("NeuralNetwork::step", iterations, seconds,
+			0);
+	// keeps the loop from being optimized away
+	json_object_set_new(result, "checksum", json_real(checksum));
+	return result;
+}
+
+void printUsage(char *argv[]) {
+	std::cout << std::endl << "USAGE: " << std::endl << "      "
+			<< std::string(argv[0]) << " <EXAMPLES_DIR, STRING> [<OPTIONS>]"
+			<< std::endl << std::endl << "WHERE: " << std::endl
+			<< "      <EXAMPLES_DIR> is the robogen examples directory."
+			<< std::endl << std::endl << "OPTIONS: " << std::endl
+			<< "      --repetitions <N, INTEGER>" << std::endl
+			<< "          Simulations of each corpus entry (default 3)."
+			<< std::endl << std::endl
+			<< "      --iterations <N, INTEGER>" << std::endl
+			<< "          Iterations of the microbenchmarks (default 1000, "
+			<< "NEAT epochs use N/100)." << std::endl << std::endl
+			<< "      --output <FILE, STRING>" << std::endl
+			<< "          Write the JSON report to FILE instead of the "
+			<< "standard output." << std::endl << std::endl;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+
+	startRobogen();
+
+#ifdef QT5_ENABLED
+	QCoreApplication a(argc, argv);
+#endif
+
+	if (argc < 2 || std::string(argv[1]) == "--help") {
+		printUsage(argv);
+		exitRobogen(argc < 2 ? EXIT_FAILURE : EXIT_SUCCESS);
+	}
+
+	std::string examplesDir(argv[1]);
+	unsigned int repetitions = 3;
+	unsigned int iterations = 1000;
+	std::string outputFile;
+
+	for (int currentArg = 2; currentArg < argc; currentArg++) {
+		std::string arg(argv[currentArg]);
+		if (currentArg + 1 >= argc) {
+			std::cerr << "Missing value for option " << arg << std::endl;
+			exitRobogen(EXIT_FAILURE);
+		}
+		std::stringstream ss(argv[++currentArg]);
+		if (arg == "--repetitions") {
+			ss >> repetitions;
+		} else if (arg == "--iterations") {
+			ss >> iterations;
+		} else if (arg == "--output") {
+			ss >> outputFile;
+		} else {
+			std::cerr << "Unknown option " << arg << std::endl;
+			printUsage(argv);
+			exitRobogen(EXIT_FAILURE);
+		}
+		if (ss.fail() || repetitions == 0 || iterations == 0) {
+			std::cerr << "Invalid value for option " << arg << std::endl;
+			exitRobogen(EXIT_FAILURE);
+		}
+	}
+
+	if (!boost::filesystem::is_directory(examplesDir)) {
+		std::cerr << "Cannot find examples directory " << examplesDir
+				<< std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	NullBuffer nullBuffer;
+	std::streambuf *coutBuffer = std::cout.rdbuf(&nullBuffer);
+
+	json_t *report = json_object();
+
+	// ---------------------------------------
+	// Simulations
+	// ---------------------------------------
+	json_t *simulations = json_array();
+	SimulationProfile totalProfile;
+	double totalSeconds = 0;
+	for (unsigned int i = 0; i < sizeof(CORPUS) / sizeof(CORPUS[0]); ++i) {
+		json_t *entry = benchSimulation(examplesDir, CORPUS[i][0],
+				CORPUS[i][1], repetitions, totalProfile, totalSeconds);
+		if (entry != NULL) {
+			json_array_append_new(simulations, entry);
+		}
+	}
+	json_object_set_new(report, "simulations", simulations);
+
+	json_t *totals = json_object();
+	json_object_set_new(totals, "seconds", json_real(totalSeconds));
+	json_object_set_new(totals, "steps", json_integer(totalProfile.getSteps()));
+	json_object_set_new(totals, "stepsPerSecond", json_real(
+			totalSeconds > 0 ? totalProfile.getSteps() / totalSeconds : 0));
+	json_object_set_new(totals, "evaluationsPerSecond", json_real(
+			totalSeconds > 0 ?
+					totalProfile.getEvaluations() / totalSeconds : 0));
+	json_object_set_new(totals, "phases", profileJson(totalProfile));
+	json_object_set_new(report, "totals", totals);
+
+	// ---------------------------------------
+	// Microbenchmarks
+	// ---------------------------------------
+	json_t *micro = json_array();
+
+	std::vector<boost::shared_ptr<RobotRepresentation> > robots;
+	for (unsigned int i = 0;
+			i < sizeof(MICRO_ROBOTS) / sizeof(MICRO_ROBOTS[0]); ++i) {
+		boost::shared_ptr<RobotRepresentation> robot(
+				new RobotRepresentation());
+		if (!robot->init(examplesDir + "/" + MICRO_ROBOTS[i])) {
+			std::cerr << "Cannot load " << MICRO_ROBOTS[i] << std::endl;
+			continue;
+		}
+		robots.push_back(robot);
+	}
+	if (!robots.empty()) {
+		json_array_append_new(micro, benchBodyVerifier(robots, iterations));
+		json_t *result = benchMutator(examplesDir, robots, iterations);
+		if (result != NULL) {
+			json_array_append_new(micro, result);
+		}
+	}
+	json_array_append_new(micro,
+			benchNeatEpoch(std::max(1u, iterations / 100)));
+	json_array_append_new(micro, benchNeuralNetwork(iterations * 1000));
+	json_object_set_new(report, "micro", micro);
+
+	std::cout.rdbuf(coutBuffer);
+
+	char *dump = json_dumps(report, JSON_INDENT(2) | JSON_PRESERVE_ORDER);
+	if (outputFile.empty()) {
+		std::cout << dump << std::endl;
+	} else {
+		std::ofstream output(outputFile.c_str());
+		output << dump << std::endl;
+		if (!output.good()) {
+			std::cerr << "Cannot write " << outputFile << std::endl;
+			free(dump);
+			json_decref(report);
+			exitRobogen(EXIT_FAILURE);
+		}
+	}
+	free(dump);
+	json_decref(report);
+
+	exitRobogen(EXIT_SUCCESS);
+}
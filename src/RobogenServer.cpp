@@ -31,6 +31,7 @@
 #include "config/ConfigurationReader.h"
 #include "config/RobogenConfig.h"
 #include "scenario/Scenario.h"
+#include "scenario/HeightMap.h"
 #include "scenario/ScenarioFactory.h"
 #include "utils/network/ProtobufPacket.h"
 #include "utils/network/TcpSocket.h"
@@ -49,16 +50,247 @@
 #include <QCoreApplication>
 #endif
 
+#ifndef WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace robogen;
 
 // ODE World
-dWorldID odeWorld;
+thread_local dWorldID odeWorld;
 
 // Container for collisions
-dJointGroupID odeContactGroup;
+thread_local dJointGroupID odeContactGroup;
 
 bool interrupted;
 
+/**
+ * Handle the evaluation requests of a connected client, until it disconnects
+ */
+void serveClient(TcpSocket &socket, bool visualize, bool startPaused,
+		boost::random::mt19937 &rng) {
+
+	while (true) {
+
+		try {
+
+			// ---------------------------------------
+			// Decode solution
+			// ---------------------------------------
+
+			ProtobufPacket<robogenMessage::EvaluationRequest> packet;
+
+			// 1) Read packet header
+			std::vector<unsigned char> headerBuffer;
+			socket.read(headerBuffer,
+					ProtobufPacket<robogenMessage::EvaluationRequest>::HEADER_SIZE);
+			unsigned int packetSize = packet.decodeHeader(headerBuffer);
+
+			// 2) Read packet size
+			std::vector<unsigned char> payloadBuffer;
+			socket.read(payloadBuffer, packetSize);
+			packet.decodePayload(payloadBuffer);
+
+			// ---------------------------------------
+			//  Decode configuration file
+			// ---------------------------------------
+
+			boost::shared_ptr<RobogenConfig> configuration =
+					ConfigurationReader::parseEvaluationRequest(
+							*packet.getMessage());
+			if (configuration == NULL) {
+				std::cerr
+						<< "Problems parsing the configuration file. Quit."
+						<< std::endl;
+				exitRobogen(EXIT_FAILURE);
+			}
+
+			// ---------------------------------------
+			// Setup environment
+			// ---------------------------------------
+
+			boost::shared_ptr<Scenario> scenario =
+					ScenarioFactory::createScenario(configuration);
+			if (scenario == NULL) {
+				exitRobogen(EXIT_FAILURE);
+			}
+
+			std::cout
+					<< "-----------------------------------------------"
+					<< std::endl;
+
+			// ---------------------------------------
+			// Run simulations
+			// ---------------------------------------
+			Viewer *viewer = NULL;
+			if(visualize) {
+				viewer = new Viewer(startPaused);
+			}
+
+			SimulationProfile profile;
+			unsigned int simulationResult = runSimulations(scenario,
+					configuration, packet.getMessage()->robot(),
+					viewer, rng, false,
+					boost::shared_ptr<FileViewerLog>(), profile);
+
+			if(viewer != NULL) {
+				delete viewer;
+			}
+
+
+			if (simulationResult == SIMULATION_FAILURE) {
+				exitRobogen(EXIT_FAILURE);
+			}
+
+			// ---------------------------------------
+			// Compute fitness
+			// ---------------------------------------
+			double fitness;
+			std::vector<double> objectives;
+			if (simulationResult == CONSTRAINT_VIOLATED) {
+				fitness = MIN_FITNESS;
+			} else {
+				fitness = scenario->getFitness();
+				objectives = scenario->getObjectives();
+			}
+			std::cout << "Fitness for the current solution: " << fitness
+					<< std::endl << std::endl;
+
+			// ---------------------------------------
+			// Send reply to EA
+			// ---------------------------------------
+			boost::shared_ptr<robogenMessage::EvaluationResult> evalResultPacket(
+					new robogenMessage::EvaluationResult());
+			evalResultPacket->set_fitness(fitness);
+			evalResultPacket->set_id(packet.getMessage()->robot().id());
+			for (unsigned int i = 0; i < objectives.size(); ++i) {
+				evalResultPacket->add_objectives(objectives[i]);
+			}
+			profile.serialize(*evalResultPacket->mutable_profile());
+			ProtobufPacket<robogenMessage::EvaluationResult> evalResult;
+			evalResult.setMessage(evalResultPacket);
+
+			std::vector<unsigned char> sendBuffer;
+			evalResult.forge(sendBuffer);
+
+			socket.write(sendBuffer);
+
+		} catch (boost::system::system_error& e) {
+			socket.close();
+			exitRobogen(EXIT_FAILURE);
+		}
+
+	}
+}
+
+/**
+ * Load ahead of the first request what a simulator configuration needs and
+ * can be kept for the whole process: the terrain height map and, for a
+ * native scenario, its plugin. Script scenarios are compiled again for
+ * every request (each gets its own script engine), they are only checked
+ * here. Meshes are not loaded, as the server does not render.
+ * @param confFileName simulator configuration file
+ * @return true if everything could be loaded
+ */
+bool preload(const std::string &confFileName) {
+
+	boost::shared_ptr<RobogenConfig> configuration =
+			ConfigurationReader::parseConfigurationFile(confFileName);
+	if (configuration == NULL) {
+		std::cerr << "Problems parsing the configuration file to preload."
+				<< std::endl;
+		return false;
+	}
+
+#ifndef DISABLE_HEIGHT_MAP
+	boost::shared_ptr<TerrainConfig> terrain =
+			configuration->getTerrainConfig();
+	if (terrain->getType() == TerrainConfig::ROUGH &&
+			!HeightMap::load(terrain->getHeightFieldFileName())) {
+		std::cerr << "Cannot preload the height map file '"
+				<< terrain->getHeightFieldFileName() << "'" << std::endl;
+		return false;
+	}
+#endif
+
+	// plugins stay loaded for the whole process, a script is only checked
+	boost::shared_ptr<Scenario> scenario =
+			ScenarioFactory::createScenario(configuration);
+	if (scenario == NULL) {
+		std::cerr << "Cannot preload the scenario." << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+#ifndef WIN32
+/**
+ * Collect the workers that exited, reporting the ones that crashed
+ */
+void reapWorkers() {
+	int status;
+	pid_t pid;
+	while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+		if (WIFSIGNALED(status)) {
+			std::cerr << "Worker " << pid << " crashed (signal "
+					<< WTERMSIG(status) << ")" << std::endl;
+		}
+	}
+}
+
+/**
+ * Zygote mode: accept clients and fork a worker for each of them. Workers
+ * start from the already initialized (and preloaded) state of this process,
+ * sharing its memory pages until they write to them.
+ */
+void runZygote(TcpSocket &socket, int port) {
+
+	// keep ODE initialized, so workers do not set it up again
+	dInitODE2(0);
+
+	unsigned int nWorkers = 0;
+	while (!interrupted) {
+
+		std::cout << "Waiting for clients..." << std::endl;
+
+		bool rc = socket.accept();
+		reapWorkers();
+		if (!rc) {
+			std::cerr << "Cannot connect to client. Exiting." << std::endl;
+			socket.close();
+			exitRobogen(EXIT_FAILURE);
+		}
+
+		++nWorkers;
+		socket.notifyFork(boost::asio::io_service::fork_prepare);
+		pid_t pid = fork();
+		if (pid < 0) {
+			std::cerr << "Cannot fork a worker. Exiting." << std::endl;
+			socket.close();
+			exitRobogen(EXIT_FAILURE);
+		}
+
+		if (pid == 0) {
+			socket.notifyFork(boost::asio::io_service::fork_child);
+			std::cout << "Worker " << getpid() << " serving client "
+					<< nWorkers << "..." << std::endl;
+
+			// each worker draws different sensor noise
+			boost::random::mt19937 rng;
+			rng.seed(port + nWorkers - 1);
+			serveClient(socket, false, false, rng);
+		}
+
+		socket.notifyFork(boost::asio::io_service::fork_parent);
+		std::cout << "Client " << nWorkers << " handed to worker " << pid
+				<< std::endl;
+	}
+}
+#endif
+
 int main(int argc, char* argv[]) {
 
 	startRobogen();
@@ -79,11 +311,22 @@ int main(int argc, char* argv[]) {
 
 	bool visualize = false;	
 	bool startPaused = false;
+	bool zygote = false;
+	std::string preloadConfFile;
 	for (int currentArg=2; currentArg<argc; currentArg++) {
 		if (std::string(argv[currentArg]).compare("--visualization") == 0) {
 			visualize = true;
 		} else if (std::string(argv[currentArg]).compare("--pause") == 0) {
 			startPaused = true;
+		} else if (std::string(argv[currentArg]).compare("--zygote") == 0) {
+			zygote = true;
+		} else if (std::string(argv[currentArg]).compare("--preload") == 0) {
+			if (currentArg + 1 >= argc) {
+				std::cerr << "--preload requires a simulator configuration "
+						<< "file." << std::endl;
+				exitRobogen(EXIT_FAILURE);
+			}
+			preloadConfFile = argv[++currentArg];
 		}
 	}
 
@@ -93,6 +336,18 @@ int main(int argc, char* argv[]) {
 		exitRobogen(EXIT_FAILURE);
 	}
 
+	if (zygote && visualize) {
+		std::cerr << "Cannot use visualization in zygote mode." << std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+
+#ifdef WIN32
+	if (zygote) {
+		std::cerr << "Zygote mode is not available on Windows." << std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+#endif
+
 
 	TcpSocket socket;
 	bool rc = socket.create(port);
@@ -110,6 +365,16 @@ int main(int argc, char* argv[]) {
 	QCoreApplication a(argc, argv);
 #endif
 
+	if (!preloadConfFile.empty() && !preload(preloadConfFile)) {
+		exitRobogen(EXIT_FAILURE);
+	}
+
+#ifndef WIN32
+	if (zygote) {
+		runZygote(socket, port);
+		exitRobogen(EXIT_SUCCESS);
+	}
+#endif
 
 	while (!interrupted) {
 
@@ -122,109 +387,7 @@ int main(int argc, char* argv[]) {
 
 			std::cout << "Client connected..." << std::endl;
 
-			while (true) {
-
-				try {
-
-					// ---------------------------------------
-					// Decode solution
-					// ---------------------------------------
-
-					ProtobufPacket<robogenMessage::EvaluationRequest> packet;
-
-					// 1) Read packet header
-					std::vector<unsigned char> headerBuffer;
-					socket.read(headerBuffer,
-							ProtobufPacket<robogenMessage::EvaluationRequest>::HEADER_SIZE);
-					unsigned int packetSize = packet.decodeHeader(headerBuffer);
-
-					// 2) Read packet size
-					std::vector<unsigned char> payloadBuffer;
-					socket.read(payloadBuffer, packetSize);
-					packet.decodePayload(payloadBuffer);
-
-					// ---------------------------------------
-					//  Decode configuration file
-					// ---------------------------------------
-
-					boost::shared_ptr<RobogenConfig> configuration =
-							ConfigurationReader::parseRobogenMessage(
-									packet.getMessage()->configuration());
-					if (configuration == NULL) {
-						std::cerr
-								<< "Problems parsing the configuration file. Quit."
-								<< std::endl;
-						exitRobogen(EXIT_FAILURE);
-					}
-
-					// ---------------------------------------
-					// Setup environment
-					// ---------------------------------------
-
-					boost::shared_ptr<Scenario> scenario =
-							ScenarioFactory::createScenario(configuration);
-					if (scenario == NULL) {
-						exitRobogen(EXIT_FAILURE);
-					}
-
-					std::cout
-							<< "-----------------------------------------------"
-							<< std::endl;
-
-					// ---------------------------------------
-					// Run simulations
-					// ---------------------------------------
-					Viewer *viewer = NULL;
-					if(visualize) {
-						viewer = new Viewer(startPaused);
-					}
-
-					unsigned int simulationResult = runSimulations(scenario,
-							configuration, packet.getMessage()->robot(),
-							viewer, rng);
-
-					if(viewer != NULL) {
-						delete viewer;
-					}
-
-
-					if (simulationResult == SIMULATION_FAILURE) {
-						exitRobogen(EXIT_FAILURE);
-					}
-
-					// ---------------------------------------
-					// Compute fitness
-					// ---------------------------------------
-					double fitness;
-					if (simulationResult == CONSTRAINT_VIOLATED) {
-						fitness = MIN_FITNESS;
-					} else {
-						fitness = scenario->getFitness();
-					}
-					std::cout << "Fitness for the current solution: " << fitness
-							<< std::endl << std::endl;
-
-					// ---------------------------------------
-					// Send reply to EA
-					// ---------------------------------------
-					boost::shared_ptr<robogenMessage::EvaluationResult> evalResultPacket(
-							new robogenMessage::EvaluationResult());
-					evalResultPacket->set_fitness(fitness);
-					evalResultPacket->set_id(packet.getMessage()->robot().id());
-					ProtobufPacket<robogenMessage::EvaluationResult> evalResult;
-					evalResult.setMessage(evalResultPacket);
-
-					std::vector<unsigned char> sendBuffer;
-					evalResult.forge(sendBuffer);
-
-					socket.write(sendBuffer);
-
-				} catch (boost::system::system_error& e) {
-					socket.close();
-					exitRobogen(EXIT_FAILURE);
-				}
-
-			}
+			serveClient(socket, visualize, startPaused, rng);
 
 		} else {
 			std::cerr << "Cannot connect to client. Exiting." << std::endl;
@@ -77,10 +77,10 @@ using namespace robogen;
 
 
 // ODE World
-dWorldID odeWorld;
+thread_local dWorldID odeWorld;
 
 // Container for collisions
-dJointGroupID odeContactGroup;
+thread_local dJointGroupID odeContactGroup;
 
 int participants = -1;
 
@@ -125,8 +125,8 @@ void bind_events(sio::socket::ptr &socket) {
 				
 
 				boost::shared_ptr<RobogenConfig> configuration =
-						ConfigurationReader::parseRobogenMessage(
-								packet.getMessage()->configuration());
+						ConfigurationReader::parseEvaluationRequest(
+								*packet.getMessage());
 				if (configuration == NULL) {
 					std::cerr
 							<< "Problems parsing the configuration file. Quit."
@@ -172,11 +172,13 @@ void bind_events(sio::socket::ptr &socket) {
 				// Compute fitness
 				// ---------------------------------------
 				double fitness;
+				std::vector<double> objectives;
 				if (simulationResult == CONSTRAINT_VIOLATED ||
 						simulationResult == SIMULATION_FAILURE) {
 					fitness = MIN_FITNESS;
 				} else {
 					fitness = scenario->getFitness();
+					objectives = scenario->getObjectives();
 				}
 
 				sio::message::ptr output = sio::object_message::create();
@@ -185,6 +187,16 @@ void bind_events(sio::socket::ptr &socket) {
 						sio::object_message::create();
 				output->get_map()["content"]->get_map()["fitness"] =
 						sio::double_message::create(fitness);
+				if (!objectives.empty()) {
+					sio::message::ptr objectivesArray =
+							sio::array_message::create();
+					for (unsigned int i = 0; i < objectives.size(); ++i) {
+						objectivesArray->get_vector().push_back(
+								sio::double_message::create(objectives[i]));
+					}
+					output->get_map()["content"]->get_map()["objectives"] =
+							objectivesArray;
+				}
 				output->get_map()["content"]->get_map()["ptr"] =
 						data->get_map()["content"]->get_map()["ptr"];
 				socket->emit("responseTask", output);
@@ -0,0 +1,546 @@
+/*
+ * @(#) RobogenSweep.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "config/ConfigurationReader.h"
+#include "config/RobogenConfig.h"
+#include "evolution/representation/RobotRepresentation.h"
+#include "scenario/Scenario.h"
+#include "scenario/ScenarioFactory.h"
+#include "utils/SimulationProfile.h"
+#include "Robogen.h"
+#include "robogen.pb.h"
+
+#include "Simulator.h"
+
+#ifdef QT5_ENABLED
+#include <QCoreApplication>
+#endif
+
+/**
+ * Parameter sweep: simulates one robot under every combination of a set of
+ * simulator configuration values (friction, noise, start positions, gravity,
+ * ...), in parallel threads of a single process, and writes one CSV row per
+ * simulation.
+ *
+ * The sweep file has one parameter per line, followed by the values to try,
+ * separated by white space:
+ *
+ *   # comment
+ *   terrainFriction = 0.5 1.0 1.5
+ *   sensorNoiseLevel = 0:0.1:0.025
+ *   startPositionConfigFile = startPos.txt startPosFar.txt
+ *   gravity = -9.81 0,0,-3.71
+ *
+ * where start:stop:step expands to the values from start to stop (included).
+ * Values are written as in the simulator configuration file, relative paths
+ * are relative to it.
+ */
+
+using namespace robogen;
+
+// ODE World
+thread_local dWorldID odeWorld;
+
+// Container for collisions
+thread_local dJointGroupID odeContactGroup;
+
+namespace {
+
+struct SweepParameter {
+	std::string name;
+	std::vector<std::string> values;
+};
+
+/**
+ * One simulation of the sweep
+ */
+struct SweepJob {
+	unsigned int setting;
+	unsigned int seed;
+
+	unsigned int result;
+	double fitness;
+	std::vector<double> objectives;
+	double seconds;
+};
+
+bool expandRange(const std::string &range, std::vector<std::string> &values) {
+	std::vector<std::string> bounds;
+	boost::split(bounds, range, boost::is_any_of(":"));
+	if (bounds.size() != 3) {
+		return false;
+	}
+	double start, stop, step;
+	try {
+		start = boost::lexical_cast<double>(bounds[0]);
+		stop = boost::lexical_cast<double>(bounds[1]);
+		step = boost::lexical_cast<double>(bounds[2]);
+	} catch (boost::bad_lexical_cast &) {
+		return false;
+	}
+	if (step <= 0 || stop < start) {
+		return false;
+	}
+	// count the steps, so that rounding does not drop the last value
+	unsigned int nSteps = (unsigned int) ((stop - start) / step + 1e-9);
+	for (unsigned int i = 0; i <= nSteps; ++i) {
+		std::stringstream ss;
+		ss << std::setprecision(10) << start + i * step;
+		values.push_back(ss.str());
+	}
+	return true;
+}
+
+bool parseSweepFile(const std::string &fileName,
+		std::vector<SweepParameter> &parameters) {
+
+	std::ifstream file(fileName.c_str());
+	if (!file.is_open()) {
+		std::cerr << "Cannot open sweep file '" << fileName << "'"
+				<< std::endl;
+		return false;
+	}
+
+	std::string line;
+	unsigned int lineNumber = 0;
+	while (std::getline(file, line)) {
+		++lineNumber;
+		size_t comment = line.find('#');
+		if (comment != std::string::npos) {
+			line = line.substr(0, comment);
+		}
+		boost::trim(line);
+		if (line.empty()) {
+			continue;
+		}
+
+		size_t equals = line.find('=');
+		SweepParameter parameter;
+		if (equals != std::string::npos) {
+			parameter.name = boost::trim_copy(line.substr(0, equals));
+		}
+		std::vector<std::string> tokens;
+		if (equals != std::string::npos) {
+			std::string values = boost::trim_copy(line.substr(equals + 1));
+			boost::split(tokens, values, boost::is_space(),
+					boost::token_compress_on);
+		}
+		if (parameter.name.empty() || tokens.empty() || tokens[0].empty()) {
+			std::cerr << "Line " << lineNumber << " of the sweep file "
+					<< "should be 'parameter = value ...'" << std::endl;
+			return false;
+		}
+
+		for (unsigned int i = 0; i < tokens.size(); ++i) {
+			if (tokens[i].find(':') == std::string::npos) {
+				parameter.values.push_back(tokens[i]);
+			} else if (!expandRange(tokens[i], parameter.values)) {
+				std::cerr << "Invalid range '" << tokens[i] << "' on line "
+						<< lineNumber << " of the sweep file, expected "
+						<< "start:stop:step" << std::endl;
+				return false;
+			}
+		}
+
+		for (unsigned int i = 0; i < parameters.size(); ++i) {
+			if (parameters[i].name == parameter.name) {
+				std::cerr << "Parameter '" << parameter.name << "' is swept "
+						<< "twice" << std::endl;
+				return false;
+			}
+		}
+		parameters.push_back(parameter);
+	}
+
+	if (parameters.empty()) {
+		std::cerr << "The sweep file does not define any parameter"
+				<< std::endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @return the values of the parameters in the given setting, the first
+ * 		parameter varying slowest
+ */
+std::vector<std::pair<std::string, std::string> > getSetting(
+		const std::vector<SweepParameter> &parameters, unsigned int setting) {
+	std::vector<std::pair<std::string, std::string> > values(
+			parameters.size());
+	for (int i = parameters.size() - 1; i >= 0; --i) {
+		unsigned int n = parameters[i].values.size();
+		values[i] = std::make_pair(parameters[i].name,
+				parameters[i].values[setting % n]);
+		setting /= n;
+	}
+	return values;
+}
+
+/**
+ * Thread function simulating jobs until there are none left
+ * @param jobs all the jobs of the sweep, results are written in place
+ * @param nextJob index of the next job to run, shared by the threads
+ * @param jobMutex mutex for access to nextJob
+ * @param robotMessage the robot, shared by all the jobs
+ * @param settings configuration of each setting, each job builds its own
+ * 		RobogenConfig from it, since scenarios are free to modify theirs
+ */
+void sweepThread(std::vector<SweepJob> &jobs, unsigned int &nextJob,
+		boost::mutex &jobMutex, const robogenMessage::Robot &robotMessage,
+		const std::vector<robogenMessage::SimulatorConf> &settings) {
+
+	while (true) {
+
+		boost::mutex::scoped_lock lock(jobMutex);
+		if (nextJob >= jobs.size()) {
+			return;
+		}
+		SweepJob &job = jobs[nextJob++];
+		lock.unlock();
+
+		SimulationProfile::Clock::time_point start = SimulationProfile::now();
+		job.result = SIMULATION_FAILURE;
+		job.fitness = MIN_FITNESS;
+
+		boost::shared_ptr<RobogenConfig> configuration =
+				ConfigurationReader::parseRobogenMessage(
+						settings[job.setting]);
+		boost::shared_ptr<Scenario> scenario;
+		if (configuration != NULL) {
+			scenario = ScenarioFactory::createScenario(configuration);
+		}
+		if (scenario != NULL) {
+			boost::random::mt19937 rng;
+			rng.seed(job.seed);
+
+			SimulationProfile profile;
+			job.result = runSimulations(scenario, configuration,
+					robotMessage, NULL, rng, false,
+					boost::shared_ptr<FileViewerLog>(), profile);
+			if (job.result == SIMULATION_SUCCESS) {
+				job.fitness = scenario->getFitness();
+				job.objectives = scenario->getObjectives();
+			}
+		}
+
+		job.seconds = std::chrono::duration<double>(
+				SimulationProfile::now() - start).count();
+	}
+}
+
+std::string csvField(const std::string &value) {
+	if (value.find_first_of(",\"\n") == std::string::npos) {
+		return value;
+	}
+	return "\"" + boost::replace_all_copy(value, "\"", "\"\"") + "\"";
+}
+
+bool writeResults(const std::string &fileName,
+		const std::vector<SweepParameter> &parameters,
+		const std::vector<SweepJob> &jobs) {
+
+	std::ofstream file(fileName.c_str());
+	if (!file.is_open()) {
+		std::cerr << "Cannot write the results to '" << fileName << "'"
+				<< std::endl;
+		return false;
+	}
+
+	unsigned int nObjectives = 0;
+	for (unsigned int i = 0; i < jobs.size(); ++i) {
+		if (jobs[i].objectives.size() > nObjectives) {
+			nObjectives = jobs[i].objectives.size();
+		}
+	}
+
+	file << "setting";
+	for (unsigned int i = 0; i < parameters.size(); ++i) {
+		file << "," << csvField(parameters[i].name);
+	}
+	file << ",seed,result,fitness";
+	for (unsigned int i = 0; i < nObjectives; ++i) {
+		file << ",objective" << i;
+	}
+	file << ",seconds" << std::endl;
+
+	file << std::setprecision(10);
+	for (unsigned int i = 0; i < jobs.size(); ++i) {
+		const SweepJob &job = jobs[i];
+		std::vector<std::pair<std::string, std::string> > setting =
+				getSetting(parameters, job.setting);
+
+		file << job.setting;
+		for (unsigned int j = 0; j < setting.size(); ++j) {
+			file << "," << csvField(setting[j].second);
+		}
+		file << "," << job.seed << ",";
+		if (job.result == SIMULATION_SUCCESS) {
+			file << "success";
+		} else if (job.result == CONSTRAINT_VIOLATED) {
+			file << "constraintViolated";
+		} else {
+			file << "failure";
+		}
+		file << "," << job.fitness;
+		for (unsigned int j = 0; j < nObjectives; ++j) {
+			file << ",";
+			if (j < job.objectives.size()) {
+				file << job.objectives[j];
+			}
+		}
+		file << "," << job.seconds << std::endl;
+	}
+	return true;
+}
+
+void printUsage(char *argv[]) {
+	std::cout << std::endl << "USAGE: " << std::endl << "      "
+			<< std::string(argv[0]) << " <ROBOT_FILE, STRING> "
+			<< "<CONFIGURATION_FILE, STRING> <SWEEP_FILE, STRING> "
+			<< "[<OPTIONS>]" << std::endl << std::endl
+			<< "WHERE: " << std::endl
+			<< "      <ROBOT_FILE> is a robot text or json file."
+			<< std::endl << std::endl
+			<< "      <CONFIGURATION_FILE> is the simulator configuration "
+			<< "the sweep starts from." << std::endl << std::endl
+			<< "      <SWEEP_FILE> lists the parameters to sweep, one per "
+			<< "line:" << std::endl
+			<< "          parameter = value value start:stop:step ..."
+			<< std::endl
+			<< "          every combination of the values is simulated."
+			<< std::endl << std::endl << "OPTIONS: " << std::endl
+			<< "      --threads <N, INTEGER>" << std::endl
+			<< "          Simulations run in parallel (default: number of "
+			<< "cores). With the quickstep solver, more than one thread "
+			<< "gives results that are not reproducible." << std::endl
+			<< std::endl
+			<< "      --repetitions <N, INTEGER>" << std::endl
+			<< "          Simulations of each setting, with different seeds "
+			<< "(default 1)." << std::endl << std::endl
+			<< "      --seed <N, INTEGER>" << std::endl
+			<< "          Seed of the first repetition (default 1), "
+			<< "repetition i uses seed + i." << std::endl << std::endl
+			<< "      --output <FILE, STRING>" << std::endl
+			<< "          CSV file receiving one row per simulation "
+			<< "(default sweep.csv)." << std::endl << std::endl;
+}
+
+bool readUnsigned(int argc, char *argv[], int &currentArg,
+		unsigned int &value) {
+	if (currentArg + 1 >= argc) {
+		std::cerr << std::string(argv[currentArg]) << " requires a value."
+				<< std::endl;
+		return false;
+	}
+	try {
+		value = boost::lexical_cast<unsigned int>(argv[++currentArg]);
+	} catch (boost::bad_lexical_cast &) {
+		std::cerr << std::string(argv[currentArg - 1]) << " requires a "
+				<< "non negative integer." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+
+	startRobogen();
+
+#ifdef QT5_ENABLED
+	QCoreApplication a(argc, argv);
+#endif
+
+	if (argc > 1 && std::string(argv[1]) == "--help") {
+		printUsage(argv);
+		exitRobogen(EXIT_SUCCESS);
+	}
+
+	if (argc < 4) {
+		printUsage(argv);
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	std::string robotFile(argv[1]);
+	std::string confFile(argv[2]);
+	std::string sweepFile(argv[3]);
+	unsigned int nThreads = boost::thread::hardware_concurrency();
+	unsigned int repetitions = 1;
+	unsigned int seed = 1;
+	std::string outputFile("sweep.csv");
+
+	for (int currentArg = 4; currentArg < argc; ++currentArg) {
+		std::string arg(argv[currentArg]);
+		if (arg == "--threads") {
+			if (!readUnsigned(argc, argv, currentArg, nThreads)) {
+				exitRobogen(EXIT_FAILURE);
+			}
+		} else if (arg == "--repetitions") {
+			if (!readUnsigned(argc, argv, currentArg, repetitions)) {
+				exitRobogen(EXIT_FAILURE);
+			}
+		} else if (arg == "--seed") {
+			if (!readUnsigned(argc, argv, currentArg, seed)) {
+				exitRobogen(EXIT_FAILURE);
+			}
+		} else if (arg == "--output") {
+			if (currentArg + 1 >= argc) {
+				std::cerr << "--output requires a file name." << std::endl;
+				exitRobogen(EXIT_FAILURE);
+			}
+			outputFile = argv[++currentArg];
+		} else {
+			std::cerr << "Unknown option '" << arg << "'." << std::endl;
+			printUsage(argv);
+			exitRobogen(EXIT_FAILURE);
+		}
+	}
+	if (nThreads == 0) {
+		nThreads = 1;
+	}
+	if (repetitions == 0) {
+		std::cerr << "--repetitions must be at least 1." << std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	std::vector<SweepParameter> parameters;
+	if (!parseSweepFile(sweepFile, parameters)) {
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	unsigned int nSettings = 1;
+	for (unsigned int i = 0; i < parameters.size(); ++i) {
+		nSettings *= parameters[i].values.size();
+	}
+
+	// the robot is decoded once, every simulation builds from the message
+	robogenMessage::Robot robotMessage;
+	if (!RobotRepresentation::createRobotMessageFromFile(robotMessage,
+			robotFile)) {
+		std::cerr << "Cannot load the robot '" << robotFile << "'."
+				<< std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	// parse every setting up front, so that a bad value stops the sweep
+	// before anything is simulated
+	std::vector<robogenMessage::SimulatorConf> settings(nSettings);
+	bool quickStep = false;
+	for (unsigned int i = 0; i < nSettings; ++i) {
+		std::vector<std::pair<std::string, std::string> > setting =
+				getSetting(parameters, i);
+		boost::shared_ptr<RobogenConfig> configuration =
+				ConfigurationReader::parseConfigurationFile(confFile,
+						setting);
+		if (configuration == NULL) {
+			std::cerr << "Invalid setting:";
+			for (unsigned int j = 0; j < setting.size(); ++j) {
+				std::cerr << " " << setting[j].first << "="
+						<< setting[j].second;
+			}
+			std::cerr << std::endl;
+			exitRobogen(EXIT_FAILURE);
+		}
+		settings[i] = configuration->serialize();
+		if (nThreads > 1 && settings[i].odethreads() > 1) {
+			// the ODE thread pool steps one world at a time
+			settings[i].set_odethreads(1);
+		}
+		quickStep |= (configuration->getSolver() ==
+				RobogenConfig::QUICKSTEP_SOLVER);
+	}
+
+	if (nThreads > 1 && quickStep) {
+		std::cout << "WARNING: quickstep draws from the process-wide ODE "
+				<< "random generator, results are not reproducible when "
+				<< "simulations run in parallel. Use solver=step or "
+				<< "--threads 1 for reproducible results." << std::endl;
+	}
+
+	std::vector<SweepJob> jobs(nSettings * repetitions);
+	for (unsigned int i = 0; i < jobs.size(); ++i) {
+		jobs[i].setting = i / repetitions;
+		jobs[i].seed = seed + i % repetitions;
+	}
+
+	std::cout << "Sweeping " << parameters.size() << " parameters: "
+			<< nSettings << " settings, " << jobs.size()
+			<< " simulations on " << nThreads << " threads" << std::endl;
+
+	// keep ODE initialized between simulations
+	dInitODE2(0);
+
+	SimulationProfile::Clock::time_point start = SimulationProfile::now();
+	unsigned int nextJob = 0;
+	boost::mutex jobMutex;
+	boost::thread_group threads;
+	for (unsigned int i = 0; i < nThreads; ++i) {
+		threads.add_thread(new boost::thread(sweepThread, boost::ref(jobs),
+				boost::ref(nextJob), boost::ref(jobMutex),
+				boost::cref(robotMessage), boost::cref(settings)));
+	}
+	threads.join_all();
+
+	dCloseODE();
+
+	double seconds = std::chrono::duration<double>(
+			SimulationProfile::now() - start).count();
+
+	unsigned int failures = 0;
+	for (unsigned int i = 0; i < jobs.size(); ++i) {
+		if (jobs[i].result == SIMULATION_FAILURE) {
+			++failures;
+		}
+	}
+
+	if (!writeResults(outputFile, parameters, jobs)) {
+		exitRobogen(EXIT_FAILURE);
+	}
+
+	std::cout << jobs.size() << " simulations in " << seconds << "s";
+	if (failures > 0) {
+		std::cout << ", " << failures << " failed";
+	}
+	std::cout << ". Results written to " << outputFile << std::endl;
+
+	exitRobogen(EXIT_SUCCESS);
+}
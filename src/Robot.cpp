@@ -37,6 +37,7 @@
 #include "Models.h"
 #include "Robot.h"
 #include "model/Connection.h"
+#include "utils/EvaluationArena.h"
 
 #include "arduino/ArduinoNNConfiguration.h"
 
@@ -287,7 +288,7 @@ bool Robot::decodeBody(const robogenMessage::Body& robotBody) {
 	bodyConnections_.reserve(robotBody.connection_size());
 	for (int i = 0; i < robotBody.connection_size(); ++i) {
 		bodyConnections_.push_back(
-				boost::shared_ptr<Connection>(new Connection()));
+				arenaShared<Connection>());
 		if (!bodyConnections_.back()->init(robotBody.connection(i),
 				bodyPartsMap_, bodyParts_)) {
 			if (printInitErrors_) {
@@ -756,7 +757,8 @@ void Robot::optimizePhysics() {
 			toMerge.push_back( bodyA );
 			toMerge.push_back( bodyB );
 
-			boost::shared_ptr<CompositeBody> composite(new CompositeBody());
+			boost::shared_ptr<CompositeBody> composite =
+					arenaShared<CompositeBody>();
 			composite->init(toMerge, odeWorld_, true);
 			composites_.push_back(composite);
 
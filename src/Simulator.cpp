@@ -26,22 +26,102 @@
  * @(#) $Id$
  */
 
+#include <cmath>
+#include <boost/thread/mutex.hpp>
 #include "Simulator.h"
 #include "utils/RobogenCollision.h"
+#include "utils/OdeThreadPool.h"
+#include "utils/EvaluationArena.h"
+#include "utils/NoiseGenerator.h"
+#include "utils/SettledStateCache.h"
 #include "Models.h"
 #include "Robot.h"
 #include "viewer/WebGLLogger.h"
 
 //#define DEBUG_MASSES
 
-// ODE World
-extern dWorldID odeWorld;
+// ODE World (one per thread, so that an evolver may simulate several
+// individuals at once)
+extern thread_local dWorldID odeWorld;
 
 // Container for collisions
-extern dJointGroupID odeContactGroup;
+extern thread_local dJointGroupID odeContactGroup;
 
 namespace robogen{
 
+boost::mutex &getOdeInitMutex() {
+	// ODE initialization is reference counted but not thread safe
+	static boost::mutex odeInitMutex;
+	return odeInitMutex;
+}
+
+namespace {
+
+/**
+ * Let the robot fall and settle on the terrain, its motors holding their
+ * initial targets and its brain disabled, or restore the state the same body
+ * settled to in an earlier evaluation from the same start pose.
+ * Either way the simulation then starts from the cached state, with fresh
+ * motors and ODE random generator, so that it does not depend on whether
+ * this run settled or restored.
+ * @return the number of steps simulated, 0 if the state was restored
+ */
+unsigned int settleRobot(boost::shared_ptr<Scenario> scenario,
+		boost::shared_ptr<RobogenConfig> configuration,
+		const robogenMessage::Robot &robotMessage,
+		const std::vector<boost::shared_ptr<Motor> > &motors,
+		dSpaceID odeSpace, bool quickStep) {
+
+	std::vector<dBodyID> bodies = SettledStateCache::getBodies(scenario);
+	std::string key = SettledStateCache::getKey(robotMessage, *configuration,
+			bodies);
+	if (SettledStateCache::restore(key, bodies)) {
+		return 0;
+	}
+
+	// own collision data, so that contacts while settling do not count as
+	// obstacle collisions of the simulation
+	CollisionData collisionData(scenario);
+
+	double step = configuration->getTimeStepLength();
+	unsigned int maxSteps = (unsigned int) std::ceil(
+			configuration->getSettleTime() / step);
+	unsigned int settledSteps = 0;
+	unsigned int count = 0;
+	while (count < maxSteps &&
+			settledSteps < SettledStateCache::SETTLED_STEPS) {
+
+		dSpaceCollide(odeSpace, &collisionData, odeCollisionCallback);
+		if (quickStep) {
+			dWorldQuickStep(odeWorld, step);
+		} else {
+			dWorldStep(odeWorld, step);
+		}
+		dJointGroupEmpty(odeContactGroup);
+		++count;
+
+		for (unsigned int i = 0; i < motors.size(); ++i) {
+			motors[i]->step(step);
+		}
+
+		if (SettledStateCache::isSettled(bodies,
+				configuration->getSettleVelocity())) {
+			++settledSteps;
+		} else {
+			settledSteps = 0;
+		}
+	}
+
+	SettledStateCache::store(key, bodies);
+	for (unsigned int i = 0; i < motors.size(); ++i) {
+		motors[i]->reset();
+	}
+	dRandSetSeed(0);
+	return count;
+}
+
+}
+
 unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		boost::shared_ptr<RobogenConfig> configuration,
 		const robogenMessage::Robot &robotMessage,
@@ -56,11 +136,19 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		const robogenMessage::Robot &robotMessage, IViewer *viewer,
 		boost::random::mt19937 &rng,
 		bool onlyOnce, boost::shared_ptr<FileViewerLog> log) {
+	SimulationProfile profile;
+	return runSimulations(scenario, configuration,
+			robotMessage, viewer, rng, onlyOnce, log, profile);
+}
 
-	bool constraintViolated = false;
+unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
+		boost::shared_ptr<RobogenConfig> configuration,
+		const robogenMessage::Robot &robotMessage, IViewer *viewer,
+		boost::random::mt19937 &rng,
+		bool onlyOnce, boost::shared_ptr<FileViewerLog> log,
+		SimulationProfile &profile) {
 
-	boost::random::normal_distribution<float> normalDistribution;
-	boost::random::uniform_01<float> uniformDistribution;
+	bool constraintViolated = false;
 
 	while (scenario->remainingTrials() && (!constraintViolated)) {
 
@@ -68,7 +156,10 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		// Simulator initialization
 		// ---------------------------------------
 
-		dInitODE();
+		{
+			boost::mutex::scoped_lock lock(getOdeInitMutex());
+			dInitODE();
+		}
 
 		// Create ODE world
 		odeWorld = dWorldCreate();
@@ -81,6 +172,28 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		dWorldSetCFM(odeWorld, 10e-6);
 		dWorldSetAutoDisableFlag(odeWorld, 1);
 
+		const bool quickStep = (configuration->getSolver() ==
+				RobogenConfig::QUICKSTEP_SOLVER);
+		if (quickStep) {
+			dWorldSetQuickStepNumIterations(odeWorld,
+					configuration->getQuickStepIterations());
+			dWorldSetQuickStepW(odeWorld, configuration->getQuickStepSOR());
+		}
+
+		// quickstep randomly reorders constraints, reseed so that results do
+		// not depend on what was simulated before in this process. The ODE
+		// generator is process-wide though: worlds stepped in parallel
+		// threads draw from the same sequence in scheduling order, so with
+		// quickstep their results are not reproducible
+		dRandSetSeed(0);
+
+#ifndef EMSCRIPTEN
+		if (configuration->getOdeThreads() > 1) {
+			OdeThreadPool::attach(odeWorld, configuration->getOdeThreads(),
+					!quickStep);
+		}
+#endif
+
 		// Create collision world
 		dSpaceID odeSpace = dSimpleSpaceCreate(0);
 
@@ -94,12 +207,14 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		// ---------------------------------------
 		// Generate Robot
 		// ---------------------------------------
-		boost::shared_ptr<Robot> robot(new Robot);
+		SimulationProfile::Clock::time_point mark = SimulationProfile::now();
+		boost::shared_ptr<Robot> robot = arenaShared<Robot>();
 		if (!robot->init(odeWorld, odeSpace, robotMessage)) {
 			std::cout << "Problems decoding the robot. Quit."
 					<< std::endl;
 			return SIMULATION_FAILURE;
 		}
+		profile.lap(SimulationProfile::ROBOT_CONSTRUCTION, mark);
 
 #ifdef DEBUG_MASSES
 		float totalMass = 0;
@@ -167,7 +282,31 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		std::vector<boost::shared_ptr<Model> > bodyParts =
 				robot->getBodyParts();
 
+		// Perceptive body parts, and the profile phase of their sensors
+		std::vector<std::pair<boost::shared_ptr<PerceptiveComponent>,
+				SimulationProfile::Phase> > perceptiveParts;
+		for (unsigned int i = 0; i < bodyParts.size(); ++i) {
+			boost::shared_ptr<PerceptiveComponent> part =
+					boost::dynamic_pointer_cast<PerceptiveComponent>(
+							bodyParts[i]);
+			if (!part) {
+				continue;
+			}
+			SimulationProfile::Phase phase = SimulationProfile::OTHER_SENSORS;
+			if (boost::dynamic_pointer_cast<CoreComponentModel>(part)) {
+				phase = SimulationProfile::IMU_SENSORS;
+			} else if (boost::dynamic_pointer_cast<IrSensorModel>(part)) {
+				phase = SimulationProfile::IR_SENSORS;
+			} else if (boost::dynamic_pointer_cast<LightSensorModel>(part)) {
+				phase = SimulationProfile::LIGHT_SENSORS;
+			} else if (boost::dynamic_pointer_cast<TouchSensorModel>(part)) {
+				phase = SimulationProfile::TOUCH_SENSORS;
+			}
+			perceptiveParts.push_back(std::make_pair(part, phase));
+		}
+
 		// Initialize scenario
+		mark = SimulationProfile::now();
 		if (!scenario->init(odeWorld, odeSpace, robot)) {
 			std::cout << "Cannot initialize scenario. Quit."
 					<< std::endl;
@@ -184,6 +323,16 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 			break;
 		}
 
+		if (configuration->getSettleTime() > 0) {
+			// settling happens within the scenario setup, only account its
+			// own time to it
+			SimulationProfile::Clock::time_point settleStart =
+					SimulationProfile::now();
+			settleRobot(scenario, configuration, robotMessage, motors,
+					odeSpace, quickStep);
+			mark += profile.lap(SimulationProfile::SETTLE, settleStart) -
+					settleStart;
+		}
 
 		// Setup environment
 		boost::shared_ptr<Environment> env =
@@ -194,6 +343,7 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 					<< std::endl;
 			return SIMULATION_FAILURE;
 		}
+		profile.lap(SimulationProfile::SCENARIO_INIT, mark);
 
 		bool visualize = (viewer != NULL);
 		if(visualize && !viewer->configureScene(bodyParts, scenario)) {
@@ -213,6 +363,17 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 
 
 
+		// Sensor and motor noise, keyed from the simulation's generator so
+		// that the noise only depends on its seed
+		const float sensorNoiseLevel = configuration->getSensorNoiseLevel();
+		const float motorNoiseLevel = configuration->getMotorNoiseLevel();
+		NoiseGenerator noise;
+		if (sensorNoiseLevel > 0 || motorNoiseLevel > 0) {
+			boost::uint64_t noiseKey = rng();
+			noiseKey = (noiseKey << 32) | rng();
+			noise.seed(noiseKey);
+		}
+
 		//setup vectors for keeping velocities
 		dReal previousLinVel[3];
 		dReal previousAngVel[3];
@@ -238,11 +399,13 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 			}
 
 
+			mark = SimulationProfile::now();
 			if (scenario->shouldStopSimulationNow()) {
 				std::cout << "Scenario has stopped the simulation!"
 						<< std::endl;
 				break;
 			}
+			mark = profile.lap(SimulationProfile::SCENARIO_CALLBACKS, mark);
 
 			if ((count++) % 500 == 0) {
 				std::cout << "." << std::flush;
@@ -250,12 +413,19 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 
 			// Collision detection
 			dSpaceCollide(odeSpace, collisionData.get(), odeCollisionCallback);
+			mark = profile.lap(SimulationProfile::COLLISION, mark);
 
 			// Step the world by one timestep
-			dWorldStep(odeWorld, step);
+			if (quickStep) {
+				dWorldQuickStep(odeWorld, step);
+			} else {
+				dWorldStep(odeWorld, step);
+			}
 
 			// Empty contact groups used for collisions handling
 			dJointGroupEmpty(odeContactGroup);
+			mark = profile.lap(SimulationProfile::WORLD_STEP, mark);
+			profile.addStep(collisionData->takeNumContacts());
 
 			if (configuration->isDisallowObstacleCollisions() &&
 					collisionData->hasObstacleCollisions()) {
@@ -308,31 +478,28 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 			env->setTimeElapsed(step);
 
 			// Update Sensors
-			for (unsigned int i = 0; i < bodyParts.size();
-					++i) {
-				if (boost::dynamic_pointer_cast<
-						PerceptiveComponent>(bodyParts[i])) {
-					boost::dynamic_pointer_cast<
-							PerceptiveComponent>(bodyParts[i])->updateSensors(
-							env);
-				}
+			mark = SimulationProfile::now();
+			for (unsigned int i = 0; i < perceptiveParts.size(); ++i) {
+				perceptiveParts[i].first->updateSensors(env);
+				mark = profile.lap(perceptiveParts[i].second, mark);
 			}
 
 			if(((count - 1) % configuration->getActuationPeriod()) == 0) {
 				// Feed neural network
 				for (unsigned int i = 0; i < sensors.size(); ++i) {
 					networkInput[i] = sensors[i]->read();
+				}
 
-					// Add sensor noise: Gaussian with std dev of
-					// sensorNoiseLevel * actualValue
-					if (configuration->getSensorNoiseLevel() > 0.0) {
-						networkInput[i] += (normalDistribution(rng) *
-								configuration->getSensorNoiseLevel() *
-								networkInput[i]);
-					}
+				// Add sensor noise: Gaussian with std dev of
+				// sensorNoiseLevel * actualValue
+				if (sensorNoiseLevel > 0) {
+					noise.addGaussianNoise(networkInput, sensors.size(),
+							sensorNoiseLevel);
 				}
 				if (log) {
+					mark = profile.lap(SimulationProfile::BRAIN, mark);
 					log->logSensors(networkInput, sensors.size());
+					mark = profile.lap(SimulationProfile::LOGGING, mark);
 				}
 
 
@@ -343,22 +510,18 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 
 				// Fetch the neural network ouputs
 				::fetch(neuralNetwork.get(), &networkOutputs[0]);
+				mark = profile.lap(SimulationProfile::BRAIN, mark);
+
+				// Add motor noise:
+				// uniform in range +/- motorNoiseLevel * actualValue
+				if (motorNoiseLevel > 0) {
+					noise.addUniformNoise(networkOutputs, motors.size(),
+							motorNoiseLevel);
+				}
 
 				// Send control to motors
 				for (unsigned int i = 0; i < motors.size(); ++i) {
 
-					// Add motor noise:
-					// uniform in range +/- motorNoiseLevel * actualValue
-					if(configuration->getMotorNoiseLevel() > 0.0) {
-						networkOutputs[i] += (
-									((uniformDistribution(rng) *
-									2.0 *
-									configuration->getMotorNoiseLevel())
-									- configuration->getMotorNoiseLevel())
-									* networkOutputs[i]);
-					}
-
-
 					if (boost::dynamic_pointer_cast<
 							RotationMotor>(motors[i])) {
 						boost::dynamic_pointer_cast<RotationMotor>(motors[i]
@@ -376,7 +539,9 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 				}
 
 				if(log) {
+					mark = profile.lap(SimulationProfile::MOTORS, mark);
 					log->logMotors(networkOutputs, motors.size());
+					mark = profile.lap(SimulationProfile::LOGGING, mark);
 				}
 			}
 
@@ -395,6 +560,8 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 
 			}
 
+			mark = profile.lap(SimulationProfile::MOTORS, mark);
+
 			if(constraintViolated || motorBurntOut) {
 				break;
 			}
@@ -405,26 +572,34 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 						<< std::endl;
 				return SIMULATION_FAILURE;
 			}
+			mark = profile.lap(SimulationProfile::SCENARIO_CALLBACKS, mark);
 
 			if(log) {
 				log->logPosition(
 					scenario->getRobot(
 							)->getCoreComponent()->getRootPosition());
+				log->logPoses(t, scenario);
 			}
 
 			if(webGLlogger) {
 				webGLlogger->log(t);
 			}
+			if (log || webGLlogger) {
+				profile.lap(SimulationProfile::LOGGING, mark);
+			}
 
 			t += step;
 
 		}
 
+		mark = SimulationProfile::now();
 		if (!scenario->endSimulation()) {
 			std::cout << "Cannot complete scenario. Quit."
 					<< std::endl;
 			return SIMULATION_FAILURE;
 		}
+		profile.lap(SimulationProfile::SCENARIO_CALLBACKS, mark);
+		profile.addEvaluation();
 
 		// ---------------------------------------
 		// Simulator finalization
@@ -447,10 +622,18 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		dSpaceDestroy(odeSpace);
 
 		// Destroy ODE world
+#ifndef EMSCRIPTEN
+		if (configuration->getOdeThreads() > 1) {
+			OdeThreadPool::detach(odeWorld);
+		}
+#endif
 		dWorldDestroy(odeWorld);
 
 		// Destroy the ODE engine
-		dCloseODE();
+		{
+			boost::mutex::scoped_lock lock(getOdeInitMutex());
+			dCloseODE();
+		}
 
 		if(constraintViolated || onlyOnce) {
 			break;
@@ -32,10 +32,12 @@
 
 #include <boost/shared_ptr.hpp>
 #include <boost/random.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "Robogen.h"
 #include "config/RobogenConfig.h"
 #include "scenario/Scenario.h"
+#include "utils/SimulationProfile.h"
 #include "viewer/FileViewerLog.h"
 #include "viewer/IViewer.h"
 
@@ -60,6 +62,12 @@ enum result{
 		CONSTRAINT_VIOLATED
 	};
 
+/**
+ * Mutex to hold around dInitODE/dCloseODE, which are not thread safe, when
+ * other threads may be simulating
+ */
+boost::mutex &getOdeInitMutex();
+
 /**
  * Runs the simulations
  * Relies on two extern variables. See .cpp.
@@ -76,6 +84,17 @@ unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
 		boost::random::mt19937 &rng,
 		bool onlyOnce, boost::shared_ptr<FileViewerLog> log);
 
+/**
+ * Runs the simulations, accumulating into profile the time spent in each
+ * phase of the simulation
+ */
+unsigned int runSimulations(boost::shared_ptr<Scenario> scenario,
+		boost::shared_ptr<RobogenConfig> configuration,
+		const robogenMessage::Robot &robotMessage, IViewer *viewer,
+		boost::random::mt19937 &rng,
+		bool onlyOnce, boost::shared_ptr<FileViewerLog> log,
+		SimulationProfile &profile);
+
 
 
 }
@@ -36,6 +36,8 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/math/special_functions/round.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/cstdint.hpp>
+#include <cmath>
 #include "model/ActuatedComponent.h"
 #include "model/PerceptiveComponent.h"
 #include "model/motors/ServoMotor.h"
@@ -57,6 +59,9 @@
 const std::string NEURAL_NETWORK_STRING =
 #include "brain/NeuralNetwork.template"
 ;
+const std::string NEURAL_NETWORK_FIXED_STRING =
+#include "brain/NeuralNetworkFixed.template"
+;
 #endif
 
 
@@ -109,8 +114,8 @@ std::string getPin(std::vector<std::string> &availableDigitalPins,
 	return pin;
 }
 
-void ArduinoNNCompiler::compile(Robot &robot, RobogenConfig &config,
-		std::ofstream &file){
+void ArduinoNNCompiler::compileInputsAndOutputs(Robot &robot,
+		RobogenConfig &config, std::ofstream &file) {
 
 	std::vector<std::string> availableDigitalPins;
 	std::vector<std::string> availableAnalogPins;
@@ -127,10 +132,6 @@ void ArduinoNNCompiler::compile(Robot &robot, RobogenConfig &config,
 		availablePwmPins.push_back(arduino::pwmOrder[i]);
 	}
 
-	std::pair<std::string, std::string> headerFooter = getHeaderAndFooter();
-
-	file << headerFooter.first << std::endl << std::endl;
-
 	int nServo = 0, nRotation = 0, nLight = 0, nTouch = 0, nIr = 0;
 	std::vector<int> input;
 	std::vector<std::string> inputPins;
@@ -295,6 +296,16 @@ void ArduinoNNCompiler::compile(Robot &robot, RobogenConfig &config,
 				availableAnalogPins, availablePwmPins, false, true);
 		file << "#define NEUTRAL_PIN " << neutralPin << std::endl << std::endl;
 	}
+}
+
+void ArduinoNNCompiler::compile(Robot &robot, RobogenConfig &config,
+		std::ofstream &file){
+
+	std::pair<std::string, std::string> headerFooter = getHeaderAndFooter();
+
+	file << headerFooter.first << std::endl << std::endl;
+
+	compileInputsAndOutputs(robot, config, file);
 
 	boost::shared_ptr<NeuralNetwork> brain = robot.getBrain();
 	file << "#define NB_INPUTS " << brain->nInputs << std::endl;
@@ -333,24 +344,210 @@ void ArduinoNNCompiler::compile(Robot &robot, RobogenConfig &config,
 	file << headerFooter.second;
 }
 
-std::pair<std::string, std::string> ArduinoNNCompiler::getHeaderAndFooter() {
-#ifdef WIN32
-	std::stringstream headerFileName;
-	headerFileName << RESOURCE_DIR << "/NeuralNetwork.h";
-	if ( !boost::filesystem::exists( headerFileName.str() ) ) {
-		std::cerr << "Cannot find NeuralNetwork.h, make sure " << headerFileName.str()
-			<< " exists" << std::endl;
-		exitRobogen(EXIT_FAILURE);
+/**
+ * Quantizes a value to a 16 bit fixed-point number
+ * @param fracBits number of fractional bits
+ * @param saturated incremented if the value does not fit
+ */
+int quantize(double value, unsigned int fracBits, unsigned int &saturated) {
+	double scaled = boost::math::round(value * (1 << fracBits));
+	if (scaled > 32767) {
+		saturated++;
+		return 32767;
+	} else if (scaled < -32767) {
+		saturated++;
+		return -32767;
 	}
-	std::ifstream headerFile(headerFileName.str().c_str());
-#else
-	std::istringstream headerFile(NEURAL_NETWORK_STRING);
-#endif
+	return (int) scaled;
+}
+
+/**
+ * Writes a lookup table of LUT_SIZE + 1 entries, in state format, of
+ * function(k / LUT_SIZE) for k in [0, LUT_SIZE]
+ */
+void writeLookupTable(std::ofstream &file, const std::string &name,
+		double (*function)(double)) {
+	unsigned int saturated = 0;
+	file << "PROGMEM const int16_t " << name << "[] = {";
+	for (unsigned int k = 0; k <= arduino::FIXED_LUT_SIZE; ++k) {
+		file << (k ? "," : "") << ((k % 16 == 0) ? "\n\t" : " ")
+				<< quantize(function(((double) k) / arduino::FIXED_LUT_SIZE),
+						arduino::FIXED_STATE_FRAC_BITS, saturated);
+	}
+	file << std::endl << "};" << std::endl;
+}
+
+double sigmoidTableFunction(double x) {
+	x = arduino::FIXED_SIGMOID_RANGE * (2 * x - 1);
+	return 1.0 / (1.0 + std::exp(-x));
+}
+
+double sineTableFunction(double x) {
+	return (std::sin(2 * M_PI * x) + 1.0) / 2.0;
+}
+
+void ArduinoNNCompiler::compileFixedPoint(Robot &robot, RobogenConfig &config,
+		std::ofstream &file) {
+
+	std::pair<std::string, std::string> headerFooter =
+			getFixedPointHeaderAndFooter();
+
+	file << headerFooter.first << std::endl << std::endl;
+
+	compileInputsAndOutputs(robot, config, file);
+
+	boost::shared_ptr<NeuralNetwork> brain = robot.getBrain();
+	unsigned int nNonInputs = brain->nOutputs + brain->nHidden;
+	file << "#define NB_INPUTS " << brain->nInputs << std::endl;
+	file << "#define NB_OUTPUTS " << brain->nOutputs << std::endl;
+	file << "#define NB_HIDDEN " << brain->nHidden << std::endl << std::endl;
+
+	// use as many fractional bits as the largest weight or gain allows
+	double maxMagnitude = 0;
+	for (unsigned int i = 0; i < (brain->nInputs + nNonInputs) * nNonInputs;
+			++i) {
+		maxMagnitude = std::max(maxMagnitude,
+				(double) std::fabs(brain->weight[i]));
+	}
+	for (unsigned int i = 0; i < nNonInputs; ++i) {
+		if (brain->types[i] == SIGMOID || brain->types[i] == SIMPLE) {
+			maxMagnitude = std::max(maxMagnitude,
+					(double) std::fabs(brain->params[MAX_PARAMS * i + 1]));
+		}
+	}
+	unsigned int weightFracBits = arduino::FIXED_MAX_WEIGHT_FRAC_BITS;
+	while (weightFracBits > arduino::FIXED_MIN_WEIGHT_FRAC_BITS &&
+			maxMagnitude * (1 << weightFracBits) > 32767) {
+		--weightFracBits;
+	}
+
+	file << "#define STATE_FRAC_BITS " << arduino::FIXED_STATE_FRAC_BITS
+			<< std::endl;
+	file << "#define WEIGHT_FRAC_BITS " << weightFracBits << std::endl;
+	file << "#define SIGMOID_RANGE " << arduino::FIXED_SIGMOID_RANGE
+			<< std::endl << std::endl;
+
+	// only keep the connections that do not quantize to zero, grouped by
+	// target neuron: sources < NB_INPUTS are inputs, others are states
+	unsigned int saturated = 0;
+	std::vector<unsigned int> connectionStart;
+	std::vector<unsigned int> connectionSource;
+	std::vector<int> connectionWeight;
+	unsigned int baseIndexOutputWeights = nNonInputs * brain->nInputs;
+	for (unsigned int i = 0; i < nNonInputs; ++i) {
+		connectionStart.push_back(connectionSource.size());
+		for (unsigned int j = 0; j < brain->nInputs + nNonInputs; ++j) {
+			float weight = (j < brain->nInputs) ?
+					brain->weight[nNonInputs * j + i] :
+					brain->weight[baseIndexOutputWeights +
+								  nNonInputs * (j - brain->nInputs) + i];
+			int quantized = quantize(weight, weightFracBits, saturated);
+			if (quantized != 0) {
+				connectionSource.push_back(j);
+				connectionWeight.push_back(quantized);
+			}
+		}
+	}
+	connectionStart.push_back(connectionSource.size());
+
+	file << "/* " << connectionSource.size() << " of "
+			<< (brain->nInputs + nNonInputs) * nNonInputs
+			<< " connections are non-zero */" << std::endl;
+	file << "PROGMEM const uint16_t EAConnectionStart[] = {";
+	for (unsigned int i=0; i<connectionStart.size(); ++i)
+		file << (i?", ":"") << connectionStart[i];
+	file << "};" << std::endl;
+	// arrays cannot be empty
+	if (connectionSource.size() == 0) {
+		connectionSource.push_back(0);
+		connectionWeight.push_back(0);
+	}
+	file << "PROGMEM const uint8_t EAConnectionSource[] = {";
+	for (unsigned int i=0; i<connectionSource.size(); ++i)
+		file << (i?", ":"") << connectionSource[i];
+	file << "};" << std::endl;
+	file << "PROGMEM const int16_t EAConnectionWeight[] = {";
+	for (unsigned int i=0; i<connectionWeight.size(); ++i)
+		file << (i?", ":"") << connectionWeight[i];
+	file << "};" << std::endl << std::endl;
+
+	// process params: biases and gains, or oscillator frequency, phase and
+	// amplitude. Frequency and phase are fractions of a period on 32 bits,
+	// the frequency per millisecond
+	std::vector<int> biases, gains, amplitudes;
+	std::vector<unsigned long> frequencies, phases;
+	for (unsigned int i = 0; i < nNonInputs; ++i) {
+		const float *params = brain->params + MAX_PARAMS * i;
+		int bias = 0, gain = 0, amplitude = 0;
+		unsigned long frequency = 0, phase = 0;
+		if (brain->types[i] == SIGMOID || brain->types[i] == SIMPLE) {
+			bias = quantize(params[0], arduino::FIXED_STATE_FRAC_BITS,
+					saturated);
+			gain = quantize(params[1], weightFracBits, saturated);
+		} else if (brain->types[i] == OSCILLATOR) {
+			double periodMs = std::max(params[0] * 1000.0, 1.0);
+			frequency = (unsigned long) std::min(
+					boost::math::round(4294967296.0 / periodMs), 4294967295.0);
+			double offset = params[1] - std::floor(params[1]);
+			phase = (unsigned long) (((boost::uint64_t) boost::math::round(
+					offset * 4294967296.0)) & 0xFFFFFFFFUL);
+			amplitude = quantize(params[2], arduino::FIXED_STATE_FRAC_BITS,
+					saturated);
+		}
+		biases.push_back(bias);
+		gains.push_back(gain);
+		amplitudes.push_back(amplitude);
+		frequencies.push_back(frequency);
+		phases.push_back(phase);
+	}
+
+	file << "PROGMEM const int16_t EABias[] = {";
+	for (unsigned int i=0; i<biases.size(); ++i)
+		file << (i?", ":"") << biases[i];
+	file << "};" << std::endl;
+	file << "PROGMEM const int16_t EAGain[] = {";
+	for (unsigned int i=0; i<gains.size(); ++i)
+		file << (i?", ":"") << gains[i];
+	file << "};" << std::endl;
+	file << "PROGMEM const int16_t EAAmplitude[] = {";
+	for (unsigned int i=0; i<amplitudes.size(); ++i)
+		file << (i?", ":"") << amplitudes[i];
+	file << "};" << std::endl;
+	file << "PROGMEM const uint32_t EAFrequency[] = {";
+	for (unsigned int i=0; i<frequencies.size(); ++i)
+		file << (i?", ":"") << frequencies[i] << "UL";
+	file << "};" << std::endl;
+	file << "PROGMEM const uint32_t EAPhase[] = {";
+	for (unsigned int i=0; i<phases.size(); ++i)
+		file << (i?", ":"") << phases[i] << "UL";
+	file << "};" << std::endl;
+	file << "PROGMEM const uint8_t EATypes[] = {";
+	for (unsigned int i=0; i<nNonInputs; ++i)
+		file << (i?", ":"") << brain->types[i];
+	file << "};" << std::endl << std::endl;
+
+	writeLookupTable(file, "EASigmoidTable", &sigmoidTableFunction);
+	writeLookupTable(file, "EASineTable", &sineTableFunction);
+
+	if (saturated > 0) {
+		std::cerr << std::endl << "ATTENTION: " << saturated
+				<< " parameters do not fit the fixed-point format and were"
+				<< " saturated, the fixed-point brain will differ from the"
+				<< " float one!" << std::endl << std::endl;
+	}
+
+	file << headerFooter.second;
+}
+
+/**
+ * Splits a NeuralNetwork template at its HEADER_FOOTER_BREAK line
+ */
+std::pair<std::string, std::string> splitTemplate(std::istream &templateFile) {
 	std::string line;
 	std::stringstream headerStream;
 	std::stringstream footerStream;
 	bool onFooter = false;
-	while (!RobogenUtils::safeGetline(headerFile, line).eof()) {
+	while (!RobogenUtils::safeGetline(templateFile, line).eof()) {
 		if(line.find("HEADER_FOOTER_BREAK") != std::string::npos) {
 			onFooter = true;
 		} else if(onFooter) {
@@ -363,6 +560,39 @@ std::pair<std::string, std::string> ArduinoNNCompiler::getHeaderAndFooter() {
 	return std::make_pair(headerStream.str(), footerStream.str());
 }
 
+#ifdef WIN32
+std::pair<std::string, std::string> readTemplate(const std::string &name) {
+	std::stringstream headerFileName;
+	headerFileName << RESOURCE_DIR << "/" << name;
+	if ( !boost::filesystem::exists( headerFileName.str() ) ) {
+		std::cerr << "Cannot find " << name << ", make sure "
+			<< headerFileName.str() << " exists" << std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+	std::ifstream headerFile(headerFileName.str().c_str());
+	return splitTemplate(headerFile);
+}
+#endif
+
+std::pair<std::string, std::string> ArduinoNNCompiler::getHeaderAndFooter() {
+#ifdef WIN32
+	return readTemplate("NeuralNetwork.h");
+#else
+	std::istringstream headerFile(NEURAL_NETWORK_STRING);
+	return splitTemplate(headerFile);
+#endif
+}
+
+std::pair<std::string, std::string>
+ArduinoNNCompiler::getFixedPointHeaderAndFooter() {
+#ifdef WIN32
+	return readTemplate("NeuralNetworkFixed.h");
+#else
+	std::istringstream headerFile(NEURAL_NETWORK_FIXED_STRING);
+	return splitTemplate(headerFile);
+#endif
+}
+
 
 
 } /* namespace robogen */
@@ -53,10 +53,32 @@ public:
 	static void compile(Robot &robot, RobogenConfig &config,
 			std::ofstream &file);
 
+	/**
+	 * Compiles the given Robot's Neural Network to the given file stream,
+	 * as a fixed-point brain: quantized weights (only the non-zero ones)
+	 * and lookup tables instead of exp and sin
+	 */
+	static void compileFixedPoint(Robot &robot, RobogenConfig &config,
+			std::ofstream &file);
+
 	/**
 	 * Gets the header and footer for NeuralNetwork.h
 	 */
 	static std::pair<std::string, std::string> getHeaderAndFooter();
+
+	/**
+	 * Gets the header and footer for NeuralNetworkFixed.h
+	 */
+	static std::pair<std::string, std::string> getFixedPointHeaderAndFooter();
+
+private:
+
+	/**
+	 * Assigns the pins of the sensors and motors and writes the input and
+	 * output tables, common to both brains
+	 */
+	static void compileInputsAndOutputs(Robot &robot, RobogenConfig &config,
+			std::ofstream &file);
 };
 
 } /* namespace robogen */
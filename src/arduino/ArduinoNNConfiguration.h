@@ -78,6 +78,19 @@ enum motorType{
 	VELOCITY_CONTROL
 };
 
+/**
+ * Fixed-point brain: fractional bits of inputs and states, range of the
+ * fractional bits of weights and gains, and lookup tables (the sigmoid one
+ * covers [-FIXED_SIGMOID_RANGE, FIXED_SIGMOID_RANGE]). The brain indexes
+ * the tables with 16 bits, so 2 * FIXED_SIGMOID_RANGE << FIXED_STATE_FRAC_BITS
+ * must divide 65536
+ */
+const unsigned int FIXED_STATE_FRAC_BITS = 10;
+const unsigned int FIXED_MIN_WEIGHT_FRAC_BITS = 6;
+const unsigned int FIXED_MAX_WEIGHT_FRAC_BITS = 14;
+const unsigned int FIXED_LUT_SIZE = 256;
+const unsigned int FIXED_SIGMOID_RANGE = 8;
+
 
 } /* namespace arduino */
 } /* namespace robogen */
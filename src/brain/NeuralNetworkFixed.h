@@ -0,0 +1,262 @@
+/*
+ * @(#) NeuralNetworkFixed.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_NEURAL_NETWORK_FIXED_H_
+#define ROBOGEN_NEURAL_NETWORK_FIXED_H_
+
+/*
+ * Fixed-point version of the Arduino brain, a drop-in replacement for the
+ * generated NeuralNetwork.h (copy it over NeuralNetwork.h in the sketch).
+ *
+ * Inputs and neuron states are int16_t with STATE_FRAC_BITS fractional bits,
+ * weights and gains are int16_t with WEIGHT_FRAC_BITS fractional bits (both
+ * chosen by the generator). Only the non-zero connections are stored, and
+ * the sigmoid and the oscillators use lookup tables instead of exp and sin.
+ */
+#define FIXED_POINT_BRAIN
+
+#include <stdint.h>
+
+#ifndef ARDUINO
+/*
+ * Host build (brain emulator): program memory is regular memory
+ */
+#define PROGMEM
+#define pgm_read_byte_near(address) (*(const uint8_t *)(address))
+#define pgm_read_word_near(address) (*(const uint16_t *)(address))
+#define pgm_read_dword_near(address) (*(const uint32_t *)(address))
+#endif
+
+/* HEADER_FOOTER_BREAK */
+
+#define NB_NON_INPUTS (NB_OUTPUTS + NB_HIDDEN)
+
+#define STATE_ONE (1L << STATE_FRAC_BITS)
+#define STATE_MIN (-32768L)
+#define STATE_MAX (32767L)
+
+/*
+ * Both lookup tables have LUT_SIZE + 1 entries and are indexed by the high
+ * byte of a 16 bit position, the low byte is used to interpolate
+ */
+#define LUT_SIZE 256
+
+/*
+ * The sigmoid table covers [-SIGMOID_RANGE, SIGMOID_RANGE]
+ */
+#define SIGMOID_LIMIT (SIGMOID_RANGE * STATE_ONE)
+#define SIGMOID_LUT_SCALE (65536L / (2L * SIGMOID_LIMIT))
+
+/*
+ * No namespace here on purpose ;-)
+ */
+
+/*
+ * Copied from NeuronRepresentation.h
+ */
+enum neuronType{
+		SIMPLE, /* corresponds to inputs */
+		SIGMOID,
+		CTRNN_SIGMOID,
+		OSCILLATOR,
+		SUPG
+};
+
+typedef struct {
+
+	/*
+	 * One state for each output and hidden neuron
+	 * activations will be used to temporarily store summed inputs before
+	 * updating states
+	 */
+	int16_t state[NB_NON_INPUTS];
+	int32_t activations[NB_NON_INPUTS];
+
+	/**
+	 * One input state for each input neuron
+	 */
+	int16_t input[NB_INPUTS];
+
+	unsigned int nInputs;
+	unsigned int nOutputs;
+	unsigned int nHidden;
+	unsigned int nNonInputs;
+
+} NeuralNetwork;
+
+int16_t saturateState(int32_t value) {
+	if (value > STATE_MAX) {
+		return STATE_MAX;
+	} else if (value < STATE_MIN) {
+		return STATE_MIN;
+	}
+	return (int16_t) value;
+}
+
+/**
+ * Multiply a state by a weight or a gain
+ * @return the product, with STATE_FRAC_BITS fractional bits
+ */
+int32_t multiplyWeight(int16_t weight, int32_t state) {
+	return ((int32_t) weight * state + (1L << (WEIGHT_FRAC_BITS - 1)))
+			>> WEIGHT_FRAC_BITS;
+}
+
+/**
+ * Linear interpolation in a lookup table
+ * @param table the table, with LUT_SIZE + 1 entries
+ * @param position index in the high byte, fraction in the low byte
+ */
+int16_t interpolate(const int16_t *table, uint16_t position) {
+	uint8_t index = position >> 8;
+	int16_t low = (int16_t) pgm_read_word_near(table + index);
+	int16_t high = (int16_t) pgm_read_word_near(table + index + 1);
+	return low + (int16_t) ((((int32_t) high - low) * (position & 0xFF)) >> 8);
+}
+
+/**
+ * Initializes the network, the parameters come from the generated tables,
+ * the weights, params and types arguments are ignored
+ */
+void initNetwork(NeuralNetwork* network, unsigned int nInputs,
+		unsigned int nOutputs, unsigned int nHidden, const float *weights,
+		const float* params, const unsigned int *types) {
+
+	unsigned int i = 0;
+
+	network->nNonInputs = nOutputs + nHidden;
+
+	/* Initialize states */
+	for (i = 0; i < network->nNonInputs; ++i) {
+		network->state[i] = 0;
+	}
+
+	/* Initialize inputs */
+	for (i = 0; i < nInputs; ++i) {
+		network->input[i] = 0;
+	}
+
+	network->nInputs = nInputs;
+	network->nOutputs = nOutputs;
+	network->nHidden = nHidden;
+}
+
+void feed(NeuralNetwork* network, const float *input) {
+
+	unsigned int i = 0;
+	for (i = 0; i < network->nInputs; ++i) {
+		float scaled = input[i] * STATE_ONE;
+		network->input[i] = saturateState((int32_t) (scaled +
+				(scaled < 0 ? -0.5f : 0.5f)));
+	}
+}
+
+void step(NeuralNetwork* network, float time) {
+
+	unsigned int i = 0;
+	unsigned int j = 0;
+	uint32_t ms = (uint32_t) (time * 1000.0f + 0.5f);
+
+	if (network->nOutputs == 0) {
+		return;
+	}
+
+	/* For each hidden and output neuron, sum the incoming connections */
+	for (i = 0; i < network->nNonInputs; ++i) {
+
+		uint16_t end = pgm_read_word_near(EAConnectionStart + i + 1);
+		network->activations[i] = 0;
+
+		for (j = pgm_read_word_near(EAConnectionStart + i); j < end; ++j) {
+			uint8_t source = pgm_read_byte_near(EAConnectionSource + j);
+			int16_t value = (source < network->nInputs) ?
+					network->input[source] :
+					network->state[source - network->nInputs];
+			network->activations[i] += multiplyWeight((int16_t)
+					pgm_read_word_near(EAConnectionWeight + j), value);
+		}
+	}
+
+	/* Now add in biases and calculate new network state */
+	for (i = 0; i < network->nNonInputs; ++i) {
+
+		uint8_t type = pgm_read_byte_near(EATypes + i);
+
+		if (type == SIGMOID || type == SIMPLE) {
+			/* params are bias, gain */
+			int32_t activation = saturateState(network->activations[i] -
+					(int16_t) pgm_read_word_near(EABias + i));
+			int32_t x = multiplyWeight((int16_t) pgm_read_word_near(EAGain + i),
+					activation);
+
+			if (type == SIGMOID) {
+				if (x <= -SIGMOID_LIMIT) {
+					network->state[i] = (int16_t)
+							pgm_read_word_near(EASigmoidTable);
+				} else if (x >= SIGMOID_LIMIT) {
+					network->state[i] = (int16_t)
+							pgm_read_word_near(EASigmoidTable + LUT_SIZE);
+				} else {
+					network->state[i] = interpolate(EASigmoidTable,
+							(uint16_t) ((x + SIGMOID_LIMIT) * SIGMOID_LUT_SCALE));
+				}
+			} else {
+				network->state[i] = saturateState(x);
+			}
+
+		} else if (type == OSCILLATOR) {
+			/*
+			 * the phase is a fraction of the period on 32 bits, so that the
+			 * overflow of the multiplication wraps it around
+			 */
+			uint32_t phase = ms * pgm_read_dword_near(EAFrequency + i) -
+					pgm_read_dword_near(EAPhase + i);
+			int16_t amplitude = (int16_t) pgm_read_word_near(EAAmplitude + i);
+
+			/* set output to be in [0.5 - gain/2, 0.5 + gain/2] */
+			network->state[i] = saturateState(STATE_ONE / 2 - amplitude / 2 +
+					(((int32_t) interpolate(EASineTable, phase >> 16) *
+							amplitude) >> STATE_FRAC_BITS));
+		}
+	}
+}
+
+/**
+ * Read the output of the neural network
+ * @param network the neural network
+ * @param output the output of the neural network, must point to an area of
+ * memory of at least size n
+ */
+void fetch(const NeuralNetwork* network, float *output) {
+
+	unsigned int i = 0;
+	for (i = 0; i < network->nOutputs; ++i) {
+		output[i] = ((float) network->state[i]) / STATE_ONE;
+	}
+}
+
+#endif /* ROBOGEN_NEURAL_NETWORK_FIXED_H_ */
@@ -0,0 +1,26 @@
+# - Helper to build native Robogen scenario plugins
+#
+#  add_robogen_scenario_plugin(<name> <source> [<source> ...])
+#
+# Builds a loadable module <name> (e.g. <name>.so) from the given sources.
+# The sources must implement a subclass of robogen::Scenario and export it
+# with the ROBOGEN_SCENARIO_PLUGIN macro from scenario/ScenarioPlugin.h.
+# The resulting library can be given as the 'scenario' parameter of a
+# simulation configuration file.
+#
+# Plugins are not linked against the robogen library: all robogen, ODE and
+# OSG symbols are resolved from the hosting executable when the plugin is
+# loaded, so a plugin must be built against the same tree (and the same
+# ROBOGEN_SCENARIO_PLUGIN_ABI_VERSION) as the simulator that loads it.
+
+macro(add_robogen_scenario_plugin name)
+	add_library(${name} MODULE ${ARGN})
+	# no "lib" prefix, so that the file name is exactly the one you pass
+	set_target_properties(${name} PROPERTIES PREFIX "")
+	# protobuf headers are generated before the plugin includes them
+	add_dependencies(${name} robogen)
+	if (APPLE)
+		set_target_properties(${name} PROPERTIES
+			LINK_FLAGS "-undefined dynamic_lookup")
+	endif()
+endmacro()
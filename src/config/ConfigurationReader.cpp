@@ -50,6 +50,9 @@
 #define DEFAULT_OBSTACLE_DENSITY (0.)
 #define DEFAULT_MAX_LINEAR_ACCELERATION (15.0)
 #define DEFAULT_MAX_ANGULAR_ACCELERATION (25.0)
+#define DEFAULT_QUICKSTEP_ITERATIONS (20)
+#define DEFAULT_QUICKSTEP_SOR (1.3)
+#define DEFAULT_SETTLE_VELOCITY (0.01)
 
 namespace robogen {
 
@@ -67,6 +70,13 @@ void makeAbsolute(std::string &fileName,
 
 boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 		const std::string& fileName) {
+	return parseConfigurationFile(fileName,
+			std::vector<std::pair<std::string, std::string> >());
+}
+
+boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
+		const std::string& fileName,
+		const std::vector<std::pair<std::string, std::string> >& overrides) {
 
 	boost::program_options::options_description desc(
 			"Allowed options for Simulation Config File");
@@ -74,7 +84,7 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 			("scenario",
 					boost::program_options::value<std::string>(),
 					"Experiment scenario: (racing, chasing, "
-					"or a provided js file)")
+					"a provided js file, or a compiled scenario plugin)")
 			("timeStep", boost::program_options::value<float>(),
 					"Time step duration (s)")
 			("nTimeSteps", boost::program_options::value<unsigned int>(),
@@ -152,6 +162,40 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 					" terminated with a constrain violation.\n"\
 					"\t'elevateRobot' -- the robot will be elevated to be"\
 					" above all obstacles before the simulation begins.\n")
+			("solver",
+					boost::program_options::value<std::string>(),
+					"ODE solver used to step the world.  Options are\n"\
+					"\t'step' -- exact (direct) solver, cost grows "\
+					"super-linearly with the number of joints and contacts"\
+					" (default).\n"\
+					"\t'quickstep' -- iterative solver, faster but less"\
+					" accurate.\n")
+			("quickStepIterations",
+					boost::program_options::value<int>(),
+					"Number of iterations of the quickstep solver"\
+					" (default 20)")
+			("quickStepSOR",
+					boost::program_options::value<float>(),
+					"Successive over-relaxation parameter of the quickstep"\
+					" solver (default 1.3)")
+			("odeThreads",
+					boost::program_options::value<unsigned int>(),
+					"Number of threads used by ODE to step independent"\
+					" islands (and large islands) in parallel.  The thread"\
+					" pool is shared by all the simulations run by a process."\
+					" Useful for large robots or crowded arenas (default 1,"\
+					" i.e. no pool)")
+			("settleTime",
+					boost::program_options::value<float>(),
+					"Maximum time (s) the robot is left to fall and settle on"\
+					" the ground, motors held and brain disabled, before the"\
+					" simulation starts.  The settled state is cached, so"\
+					" later evaluations of the same body, from the same"\
+					" start pose, skip it (default 0, i.e. no settle phase)")
+			("settleVelocity",
+					boost::program_options::value<float>(),
+					"Linear (m/s) and angular (rad/s) speed below which the"\
+					" robot is considered settled (default 0.01)")
 			;
 
 	if (fileName == "help") {
@@ -162,9 +206,29 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 	boost::program_options::variables_map vm;
 
 	try {
-		boost::program_options::store(
-			boost::program_options::parse_config_file<char>(fileName.c_str(),
-					desc, false), vm);
+		boost::program_options::parsed_options parsed =
+				boost::program_options::parse_config_file<char>(
+						fileName.c_str(), desc, false);
+		for (unsigned int i = 0; i < overrides.size(); ++i) {
+			const std::string &key = overrides[i].first;
+			if (desc.find_nothrow(key, false) == NULL) {
+				std::cerr << "Unknown simulator configuration parameter '"
+						<< key << "'" << std::endl;
+				return boost::shared_ptr<RobogenConfig>();
+			}
+			std::vector<boost::program_options::option>::iterator it =
+					parsed.options.begin();
+			while (it != parsed.options.end()) {
+				if (it->string_key == key) {
+					it = parsed.options.erase(it);
+				} else {
+					++it;
+				}
+			}
+			parsed.options.push_back(boost::program_options::option(key,
+					std::vector<std::string>(1, overrides[i].second)));
+		}
+		boost::program_options::store(parsed, vm);
 		boost::program_options::notify(vm);
 	} catch (std::exception &e) {
 		std::cerr << "Error while processing simulator configuration: "
@@ -335,9 +399,24 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 					boost::filesystem::absolute(scenarioFilePath,
 							filePath.parent_path());
 			scenarioFile = absolutePath.string();
+		} else {
+			scenarioFile = scenario;
 		}
-		if(boost::filesystem::path(scenarioFile).extension().string().compare(".js")
-				== 0) {
+		const std::string extension =
+				boost::filesystem::path(scenarioFile).extension().string();
+		if(extension.compare(".so") == 0 || extension.compare(".dylib") == 0
+				|| extension.compare(".dll") == 0) {
+
+			// native scenario plugin: keep the path, the library is loaded
+			// by the simulator (which must be able to access the same path)
+			if (!boost::filesystem::exists(scenarioFile)) {
+				std::cout << "Cannot find scenario plugin: '" << scenarioFile
+						<< "'" << std::endl;
+				return boost::shared_ptr<RobogenConfig>();
+			}
+			scenario = scenarioFile;
+
+		} else if(extension.compare(".js") == 0) {
 
 			//read entire js file into string buffer
 
@@ -489,6 +568,63 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 		return boost::shared_ptr<RobogenConfig>();
 	}
 
+	unsigned int solver;
+	if((!vm.count("solver")) ||
+			(vm["solver"].as<std::string>() == "step")) {
+		solver = RobogenConfig::STEP_SOLVER;
+	} else if(vm["solver"].as<std::string>() == "quickstep") {
+		solver = RobogenConfig::QUICKSTEP_SOLVER;
+	} else {
+		std::cerr << "Invalid value: '" << vm["solver"].as<std::string>() <<
+				"' given for 'solver'" << std::endl;
+		return boost::shared_ptr<RobogenConfig>();
+	}
+
+	int quickStepIterations = DEFAULT_QUICKSTEP_ITERATIONS;
+	if(vm.count("quickStepIterations")) {
+		quickStepIterations = vm["quickStepIterations"].as<int>();
+		if (quickStepIterations < 1) {
+			std::cerr << "'quickStepIterations' must be positive" << std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+	}
+
+	float quickStepSOR = DEFAULT_QUICKSTEP_SOR;
+	if(vm.count("quickStepSOR")) {
+		quickStepSOR = vm["quickStepSOR"].as<float>();
+		if (quickStepSOR <= 0 || quickStepSOR >= 2) {
+			std::cerr << "'quickStepSOR' must be in (0, 2)" << std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+	}
+
+	unsigned int odeThreads = 1;
+	if(vm.count("odeThreads")) {
+		odeThreads = vm["odeThreads"].as<unsigned int>();
+		if (odeThreads < 1) {
+			std::cerr << "'odeThreads' must be positive" << std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+	}
+
+	float settleTime = 0;
+	if(vm.count("settleTime")) {
+		settleTime = vm["settleTime"].as<float>();
+		if (settleTime < 0) {
+			std::cerr << "'settleTime' cannot be negative" << std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+	}
+
+	float settleVelocity = DEFAULT_SETTLE_VELOCITY;
+	if(vm.count("settleVelocity")) {
+		settleVelocity = vm["settleVelocity"].as<float>();
+		if (settleVelocity <= 0) {
+			std::cerr << "'settleVelocity' must be positive" << std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+	}
+
 	return boost::shared_ptr<RobogenConfig>(
 			new RobogenConfig(scenario, scenarioFile, nTimeSteps,
 					timeStep, actuationPeriod, terrain,
@@ -498,7 +634,8 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseConfigurationFile(
 					motorNoiseLevel, capAcceleration, maxLinearAcceleration,
 					maxAngularAcceleration, maxDirectionShiftsPerSecond,
 					gravity, disallowObstacleCollisions,
-					obstacleOverlapPolicy));
+					obstacleOverlapPolicy, solver, quickStepIterations,
+					quickStepSOR, odeThreads, settleTime, settleVelocity));
 
 }
 
@@ -780,9 +917,53 @@ boost::shared_ptr<RobogenConfig> ConfigurationReader::parseRobogenMessage(
 							  simulatorConf.gravityy(),
 							  simulatorConf.gravityz()),
 					simulatorConf.disallowobstaclecollisions(),
-					simulatorConf.obstacleoverlappolicy()
+					simulatorConf.obstacleoverlappolicy(),
+					simulatorConf.solver(),
+					simulatorConf.quickstepiterations(),
+					simulatorConf.quickstepsor(),
+					simulatorConf.odethreads(),
+					simulatorConf.settletime(),
+					simulatorConf.settlevelocity()
 					));
 
 }
 
+boost::shared_ptr<RobogenConfig> ConfigurationReader::parseEvaluationRequest(
+		const robogenMessage::EvaluationRequest& request) {
+
+	if (!request.has_simulationtime() && !request.has_startpositions()) {
+		return parseRobogenMessage(request.configuration());
+	}
+
+	robogenMessage::SimulatorConf simulatorConf = request.configuration();
+
+	if (request.has_simulationtime()) {
+		int nTimeSteps = boost::math::iround(request.simulationtime() /
+				simulatorConf.timestep());
+		if (nTimeSteps < 1) {
+			std::cerr << "Requested simulation time " <<
+					request.simulationtime() << " is shorter than a time step"
+					<< std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+		simulatorConf.set_ntimesteps(nTimeSteps);
+	}
+
+	if (request.has_startpositions()) {
+		if (request.startpositions() < 1) {
+			std::cerr << "At least one start position must be requested"
+					<< std::endl;
+			return boost::shared_ptr<RobogenConfig>();
+		}
+		int nStartPositions = request.startpositions();
+		if (nStartPositions < simulatorConf.startpositions_size()) {
+			simulatorConf.mutable_startpositions()->DeleteSubrange(
+					nStartPositions,
+					simulatorConf.startpositions_size() - nStartPositions);
+		}
+	}
+
+	return parseRobogenMessage(simulatorConf);
+}
+
 }
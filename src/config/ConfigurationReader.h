@@ -30,6 +30,8 @@
 
 #include <boost/shared_ptr.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 #include "robogen.pb.h"
 
 namespace robogen {
@@ -66,9 +68,27 @@ public:
 	static boost::shared_ptr<RobogenConfig> parseConfigurationFile(
 			const std::string& fileName);
 
+	/**
+	 * Reads the configuration file for ROBOGEN, replacing the values of some
+	 * of its parameters (or adding them, if the file does not set them)
+	 * @param fileName configuration file
+	 * @param overrides (parameterName, parameterValue) pairs, values are
+	 * 		written as they would be in the file
+	 */
+	static boost::shared_ptr<RobogenConfig> parseConfigurationFile(
+			const std::string& fileName,
+			const std::vector<std::pair<std::string, std::string> >& overrides);
+
 	static boost::shared_ptr<RobogenConfig> parseRobogenMessage(
 				const robogenMessage::SimulatorConf& simulatorConf);
 
+	/**
+	 * Decode the configuration of an evaluation request, applying its
+	 * simulation time and start positions overrides, if any
+	 */
+	static boost::shared_ptr<RobogenConfig> parseEvaluationRequest(
+				const robogenMessage::EvaluationRequest& request);
+
 private:
 
 	/**
@@ -92,8 +92,21 @@ bool EvolverConfiguration::init(std::string configFileName) {
 
 	//defaults - TODO add more
 	tournamentSize = 2;
+	rankPressure = 1.5;
+	truncationFraction = 0.5;
 
 	useBrainSeed = false;
+	evaluationThreads = 0;
+	lowFidelitySimulationTime = 0;
+	lowFidelityStartPositions = 0;
+	promotedFraction = 0.5;
+	surrogateOversampling = 1;
+	surrogateHistory = 1000;
+	islandPort = 0;
+	migrationInterval = 10;
+	migrationSize = 1;
+	cmaesSigma = 0.3;
+	cmaesMaxRestarts = 9;
 
 	minBrainPhaseOffset = -1;
 	maxBrainPhaseOffset = 1;
@@ -141,11 +154,23 @@ bool EvolverConfiguration::init(std::string configFileName) {
 				->required(), "Number of generations to be evaluated")
 		("selection",
 				boost::program_options::value<std::string>(),
-				"Type of selection strategy: deterministic-tournament")
+				"Type of selection strategy: deterministic-tournament, "\
+				"nsga2 (multi-objective, on the scenario's objectives, "\
+				"without the island model), "\
+				"linear-rank, sus (stochastic universal sampling, fitness "\
+				"proportional) or truncation")
 		("tournamentSize",
 				boost::program_options::value<unsigned int>(&tournamentSize),
 				"Number of participants in deterministic tournament "\
 				"(default 2)")
+		("rankPressure",
+				boost::program_options::value<double>(&rankPressure),
+				"Selection pressure of linear-rank selection, between 1 "\
+				"(uniform) and 2 (default 1.5)")
+		("truncationFraction",
+				boost::program_options::value<double>(&truncationFraction),
+				"Fraction of the best individuals truncation selection "\
+				"picks from (default 0.5)")
 		("replacement",
 				boost::program_options::value<std::string>()->required(),
 				"Type of replacement strategy: comma or plus")
@@ -158,10 +183,29 @@ bool EvolverConfiguration::init(std::string configFileName) {
 				"re-initialing.")
 		("evolutionaryAlgorithm",
 				boost::program_options::value<std::string>(),
-				"EA: Basic or HyperNEAT")
+				"EA: Basic, HyperNEAT, CMAES or MAPElites")
 		("neatParamsFile",
 				boost::program_options::value<std::string>(&neatParamsFile),
 				"File for NEAT/HyperNEAT specific params")
+		("cmaesSigma",
+				boost::program_options::value<double>(&cmaesSigma),
+				"CMA-ES: initial step size, relative to the range of each "\
+				"brain parameter (default 0.3)")
+		("cmaesMaxRestarts",
+				boost::program_options::value<unsigned int>(
+				&cmaesMaxRestarts),
+				"CMA-ES: maximum number of restarts when the search stalls, "\
+				"each doubling lambda and mu (default 9)")
+		("mapElitesDescriptor",
+				boost::program_options::value<std::vector<std::string> >(),
+				"MAP-Elites: axis of the archive grid, "\
+				"<descriptor>:<min>:<max>:<bins> where descriptor is parts, "\
+				"limbs, motors, sensors, hidden or objective<k> (the k-th "\
+				"objective of the scenario), can be given several times")
+		("mapElitesArchive",
+				boost::program_options::value<std::string>(&mapElitesArchive),
+				"MAP-Elites: archive journal (MapElitesArchive.dat) of a "\
+				"previous run to resume from")
 		("pBrainMutate", boost::program_options::value<double>
 				(&pBrainMutate)->required(),
 				"Probability of mutation for any single brain "\
@@ -223,8 +267,58 @@ bool EvolverConfiguration::init(std::string configFileName) {
 				boost::program_options::value<unsigned int>(
 				&maxBodyMutationAttempts),
 				"Max number of body mutation attempts")
-		("socket", boost::program_options::value<std::vector<std::string> >()
-				->required(),	"Sockets to be used to connect to the server")
+		("socket", boost::program_options::value<std::vector<std::string> >(),
+				"Sockets to be used to connect to the server")
+		("evaluationThreads",
+				boost::program_options::value<unsigned int>(
+				&evaluationThreads),
+				"Number of threads simulating individuals inside the evolver "\
+				"process, instead of sending them to servers. Running more "\
+				"than one requires ODE built with --enable-ou, and is not "\
+				"reproducible with the quickstep solver.")
+		("lowFidelitySimulationTime",
+				boost::program_options::value<float>(
+				&lowFidelitySimulationTime),
+				"If set, individuals are first simulated for only this long "\
+				"(s), and only the best promotedFraction of them for the full "\
+				"simulation time")
+		("lowFidelityStartPositions",
+				boost::program_options::value<unsigned int>(
+				&lowFidelityStartPositions),
+				"If set, individuals are first simulated from only this many "\
+				"start positions, and only the best promotedFraction of them "\
+				"from all")
+		("promotedFraction",
+				boost::program_options::value<double>(&promotedFraction),
+				"Fraction of the individuals evaluated at low fidelity that "\
+				"are then evaluated at full fidelity (default 0.5)")
+		("surrogateOversampling",
+				boost::program_options::value<unsigned int>(
+				&surrogateOversampling),
+				"If > 1, generate this many times lambda offspring and only "\
+				"simulate the lambda predicted best by a surrogate model")
+		("surrogateHistory",
+				boost::program_options::value<unsigned int>(
+				&surrogateHistory),
+				"Number of most recent evaluations the surrogate model is "\
+				"trained on (default 1000)")
+		("islandPort",
+				boost::program_options::value<int>(&islandPort),
+				"Island model: port on which to receive migrants from other "\
+				"evolvers")
+		("migrationTarget",
+				boost::program_options::value<std::vector<std::string> >(),
+				"Island model: evolver (ip:port) to send migrants to, "\
+				"can be given several times")
+		("migrationInterval",
+				boost::program_options::value<unsigned int>(
+				&migrationInterval),
+				"Island model: number of generations between migrations "\
+				"(default 10)")
+		("migrationSize",
+				boost::program_options::value<unsigned int>(&migrationSize),
+				"Island model: number of best individuals sent at each "\
+				"migration (default 1)")
 		("addBodyPart",
 				boost::program_options::value<std::vector<std::string> >(
 				&allowedBodyPartTypeStrings),
@@ -270,11 +364,24 @@ bool EvolverConfiguration::init(std::string configFileName) {
 			vm["selection"].as<std::string>() == "deterministic-tournament"){
 		selection = DETERMINISTIC_TOURNAMENT;
 	}
+	else if (vm["selection"].as<std::string>() == "nsga2"){
+		selection = NSGA2;
+	}
+	else if (vm["selection"].as<std::string>() == "linear-rank"){
+		selection = LINEAR_RANK;
+	}
+	else if (vm["selection"].as<std::string>() == "sus"){
+		selection = STOCHASTIC_UNIVERSAL_SAMPLING;
+	}
+	else if (vm["selection"].as<std::string>() == "truncation"){
+		selection = TRUNCATION;
+	}
 	else {
 		std::cerr << "Specified selection strategy \"" <<
 				vm["selection"].as<std::string>() <<
-				"\" unknown. Options are \"deterministic-tournament\" or ..."
-				 << std::endl;
+				"\" unknown. Options are \"deterministic-tournament\", "\
+				"\"nsga2\", \"linear-rank\", \"sus\" or \"truncation\"" <<
+				std::endl;
 		return false;
 	}
 
@@ -394,8 +501,10 @@ bool EvolverConfiguration::init(std::string configFileName) {
 	// on the TcpSocket to find the error... else:
 	// http://www.regular-expressions.info/examples.html
 	static const boost::regex socketRegex("^([\\d\\.]*):(\\d*)$");
-	std::vector<std::string> encSocket =
-			vm["socket"].as<std::vector<std::string> >();
+	std::vector<std::string> encSocket;
+	if (vm.count("socket") > 0) {
+		encSocket = vm["socket"].as<std::vector<std::string> >();
+	}
 	sockets.clear();
 	for (unsigned int i = 0; i<encSocket.size(); i++){
 		// match[0]:whole string, match[1]:IP, match[2]:port
@@ -409,17 +518,142 @@ bool EvolverConfiguration::init(std::string configFileName) {
 				std::atoi(match[2].first)));
 	}
 
+	// parse migration targets, same format as sockets
+	std::vector<std::string> encTarget;
+	if (vm.count("migrationTarget") > 0) {
+		encTarget = vm["migrationTarget"].as<std::vector<std::string> >();
+	}
+	migrationTargets.clear();
+	for (unsigned int i = 0; i<encTarget.size(); i++){
+		if (!boost::regex_match(encTarget[i].c_str(), match, socketRegex)){
+			std::cerr << "Supplied migrationTarget argument \"" <<
+					encTarget[i] << "\" does not match pattern "\
+					"<ip address>:<port>" << std::endl;
+			return false;
+		}
+		migrationTargets.push_back(std::pair<std::string, int>(
+				std::string(match[1]), std::atoi(match[2].first)));
+	}
+
+	// parse MAP-Elites grid axes
+	static const boost::regex descriptorRegex("^(parts|limbs|motors|sensors|"
+			"hidden|objective\\d+):([-+\\d\\.eE]+):([-+\\d\\.eE]+):(\\d+)$");
+	std::vector<std::string> encDescriptor;
+	if (vm.count("mapElitesDescriptor") > 0) {
+		encDescriptor = vm["mapElitesDescriptor"].as<
+				std::vector<std::string> >();
+	}
+	mapElitesDescriptors.clear();
+	for (unsigned int i = 0; i<encDescriptor.size(); i++){
+		if (!boost::regex_match(encDescriptor[i].c_str(), match,
+				descriptorRegex)){
+			std::cerr << "Supplied mapElitesDescriptor argument \"" <<
+					encDescriptor[i] << "\" does not match pattern "\
+					"<descriptor>:<min>:<max>:<bins>" << std::endl;
+			return false;
+		}
+		MapElitesDescriptor descriptor;
+		descriptor.name = std::string(match[1]);
+		descriptor.min = std::atof(match[2].first);
+		descriptor.max = std::atof(match[3].first);
+		descriptor.bins = std::atoi(match[4].first);
+		mapElitesDescriptors.push_back(descriptor);
+	}
+
 	// now that everything is parsed, we verify configuration validity
 	// ===================================
 
-	// - if selection is deterministic tournament, 1 <= tournamentSize <= mu
-	if (selection == DETERMINISTIC_TOURNAMENT && (tournamentSize < 1 ||
+	// - individuals are either sent to servers or simulated in-process
+	if (sockets.empty() && evaluationThreads == 0) {
+		std::cerr << "Either socket or evaluationThreads must be specified"
+				<< std::endl;
+		return false;
+	}
+
+	// - multi-fidelity evaluation parameters
+	if (lowFidelitySimulationTime < 0) {
+		std::cerr << "lowFidelitySimulationTime must not be negative"
+				<< std::endl;
+		return false;
+	}
+
+	if (promotedFraction <= 0. || promotedFraction > 1.) {
+		std::cerr << "promotedFraction " << promotedFraction <<
+				" not in (0, 1]" << std::endl;
+		return false;
+	}
+
+	// - surrogate pre-screening parameters
+	if (surrogateOversampling < 1) {
+		std::cerr << "surrogateOversampling must be at least 1" << std::endl;
+		return false;
+	}
+
+	if (surrogateOversampling > 1 && surrogateHistory < 2) {
+		std::cerr << "surrogateHistory must be at least 2" << std::endl;
+		return false;
+	}
+
+	// - island model parameters
+	if (islandPort < 0) {
+		std::cerr << "islandPort must not be negative" << std::endl;
+		return false;
+	}
+
+	if (migrationInterval < 1) {
+		std::cerr << "migrationInterval must be at least 1" << std::endl;
+		return false;
+	}
+
+	if (!migrationTargets.empty() && (migrationSize < 1 ||
+			migrationSize > mu)) {
+		std::cerr << "migrationSize should be between 1 and mu, but is "
+				<< migrationSize << std::endl;
+		return false;
+	}
+
+	// - if selection is tournament based, 1 <= tournamentSize <= mu
+	if ((selection == DETERMINISTIC_TOURNAMENT || selection == NSGA2) &&
+			(tournamentSize < 1 ||
 			tournamentSize > mu)){
 		std::cerr << "Specified tournament size should be between 1 and mu, "\
 				"but is " << tournamentSize << std::endl;
 		return false;
 	}
 
+	// - migrants only carry their fitness, and replace the individuals of
+	// lowest fitness, which means nothing under Pareto ranking
+	if (selection == NSGA2 && (islandPort != 0 ||
+			!migrationTargets.empty())) {
+		std::cerr << "The island model is not available with NSGA-II "
+				<< "selection" << std::endl;
+		return false;
+	}
+
+#ifdef EMSCRIPTEN
+	// - browser evaluations only report the fitness, NSGA-II would rank
+	// empty objective vectors
+	if (selection == NSGA2) {
+		std::cerr << "NSGA-II selection is not available in the javascript "
+				<< "build, which does not receive scenario objectives"
+				<< std::endl;
+		return false;
+	}
+#endif
+
+	if (selection == LINEAR_RANK && (rankPressure < 1. || rankPressure > 2.)) {
+		std::cerr << "rankPressure " << rankPressure << " not in [1, 2]"
+				<< std::endl;
+		return false;
+	}
+
+	if (selection == TRUNCATION && (truncationFraction <= 0. ||
+			truncationFraction > 1.)) {
+		std::cerr << "truncationFraction " << truncationFraction <<
+				" not in (0, 1]" << std::endl;
+		return false;
+	}
+
 	// - if replacement is comma, lambda must exceed mu
 	if (replacement == COMMA_REPLACEMENT && lambda < mu){
 		std::cerr << "If replacement is comma, lambda must be bigger than mu,"\
@@ -606,6 +840,18 @@ bool EvolverConfiguration::init(std::string configFileName) {
 				return false;
 			}
 
+			if (surrogateOversampling > 1) {
+				std::cerr << "Surrogate pre-screening is not available "
+						<< "with HyperNEAT" << std::endl;
+				return false;
+			}
+
+			if (islandPort != 0 || !migrationTargets.empty()) {
+				std::cerr << "The island model is not available "
+						<< "with HyperNEAT" << std::endl;
+				return false;
+			}
+
 			evolutionaryAlgorithm = HYPER_NEAT;
 			neatParams.PopulationSize = mu;
 
@@ -669,6 +915,106 @@ bool EvolverConfiguration::init(std::string configFileName) {
 					return false;
 				}
 			}
+		} else if (vm["evolutionaryAlgorithm"].as<std::string>().compare(
+				"CMAES") == 0) {
+
+			if (evolutionMode == FULL_EVOLVER) {
+				std::cerr << "CMA-ES only optimizes the brain of a fixed "
+						<< "body, use evolutionMode=brain" << std::endl;
+				return false;
+			}
+
+			if (pAddHiddenNeuron > 0.) {
+				std::cerr << "CMA-ES needs a fixed brain topology, "
+						<< "pAddHiddenNeuron must be 0" << std::endl;
+				return false;
+			}
+
+			if (surrogateOversampling > 1) {
+				std::cerr << "Surrogate pre-screening is not available "
+						<< "with CMA-ES" << std::endl;
+				return false;
+			}
+
+			if (islandPort != 0 || !migrationTargets.empty()) {
+				std::cerr << "The island model is not available "
+						<< "with CMA-ES" << std::endl;
+				return false;
+			}
+
+			if (mu < 1 || mu > lambda) {
+				std::cerr << "With CMA-ES, mu is the number of recombined "
+						<< "samples and must be between 1 and lambda"
+						<< std::endl;
+				return false;
+			}
+
+			if (cmaesSigma <= 0.) {
+				std::cerr << "cmaesSigma must be positive" << std::endl;
+				return false;
+			}
+
+			evolutionaryAlgorithm = CMAES;
+		} else if (vm["evolutionaryAlgorithm"].as<std::string>().compare(
+				"MAPElites") == 0) {
+
+			if (mapElitesDescriptors.empty()) {
+				std::cerr << "MAP-Elites needs at least one "
+						<< "mapElitesDescriptor" << std::endl;
+				return false;
+			}
+
+			// cells are numbered on 64 bits
+			double numCells = 1;
+			for (unsigned int i = 0; i < mapElitesDescriptors.size(); ++i) {
+				const MapElitesDescriptor &descriptor =
+						mapElitesDescriptors[i];
+				if (descriptor.bins < 1 || descriptor.max <= descriptor.min) {
+					std::cerr << "mapElitesDescriptor " << descriptor.name
+							<< " needs max > min and at least one bin"
+							<< std::endl;
+					return false;
+				}
+				numCells *= descriptor.bins;
+			}
+			if (numCells > 1e18) {
+				std::cerr << "The MAP-Elites grid has too many cells"
+						<< std::endl;
+				return false;
+			}
+
+			// insertion is asynchronous, there are no generations to stage
+			// or screen
+			if (lowFidelitySimulationTime > 0 ||
+					lowFidelityStartPositions > 0) {
+				std::cerr << "Multi-fidelity evaluation is not available "
+						<< "with MAP-Elites" << std::endl;
+				return false;
+			}
+
+			if (surrogateOversampling > 1) {
+				std::cerr << "Surrogate pre-screening is not available "
+						<< "with MAP-Elites" << std::endl;
+				return false;
+			}
+
+			if (islandPort != 0 || !migrationTargets.empty()) {
+				std::cerr << "The island model is not available "
+						<< "with MAP-Elites" << std::endl;
+				return false;
+			}
+
+			if ( mapElitesArchive.compare("") != 0 ) {
+				const boost::filesystem::path archivePath(mapElitesArchive);
+				if (!archivePath.is_absolute()) {
+					const boost::filesystem::path absolutePath =
+							boost::filesystem::absolute(archivePath,
+									confFilePath.parent_path());
+					mapElitesArchive = absolutePath.string();
+				}
+			}
+
+			evolutionaryAlgorithm = MAP_ELITES;
 		}
 	}
 
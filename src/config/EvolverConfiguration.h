@@ -54,7 +54,8 @@ typedef struct EvolverConfiguration {
 	 * Types of selection strategies
 	 */
 	enum SelectionTypes{
-		DETERMINISTIC_TOURNAMENT
+		DETERMINISTIC_TOURNAMENT, NSGA2, LINEAR_RANK,
+		STOCHASTIC_UNIVERSAL_SAMPLING, TRUNCATION
 	};
 
 	/**
@@ -66,10 +67,9 @@ typedef struct EvolverConfiguration {
 
 	/**
 	 * Evolationary Algorithm
-	 * TODO add other possibilities (e.g. CMA-ES)
 	 */
 	enum EvolutionaryAlgorithms {
-		BASIC, HYPER_NEAT
+		BASIC, HYPER_NEAT, CMAES, MAP_ELITES
 	};
 
 
@@ -134,6 +134,17 @@ typedef struct EvolverConfiguration {
 	 */
 	unsigned int tournamentSize;
 
+	/**
+	 * Selection pressure of linear ranking, expected number of selections
+	 * of the best individual relative to the average one, in [1, 2]
+	 */
+	double rankPressure;
+
+	/**
+	 * Fraction of the best individuals selected from by truncation selection
+	 */
+	double truncationFraction;
+
 	/**
 	 * Employed replacement strategy
 	 */
@@ -155,6 +166,63 @@ typedef struct EvolverConfiguration {
 	 */
 	std::vector<std::pair<std::string, int> > sockets;
 
+	/**
+	 * Number of threads simulating individuals in-process, if > 0 the
+	 * sockets are not used
+	 */
+	unsigned int evaluationThreads;
+
+	/**
+	 * Multi-fidelity evaluation: simulation time (s) of the first, low
+	 * fidelity evaluation of every individual, 0 if not used
+	 */
+	float lowFidelitySimulationTime;
+
+	/**
+	 * Multi-fidelity evaluation: number of start positions of the first, low
+	 * fidelity evaluation of every individual, 0 if not used
+	 */
+	unsigned int lowFidelityStartPositions;
+
+	/**
+	 * Multi-fidelity evaluation: fraction of the best individuals at low
+	 * fidelity that are evaluated again at full fidelity
+	 */
+	double promotedFraction;
+
+	/**
+	 * Surrogate pre-screening: number of candidate offspring generated per
+	 * offspring simulated, 1 to disable
+	 */
+	unsigned int surrogateOversampling;
+
+	/**
+	 * Surrogate pre-screening: number of most recent evaluations the model
+	 * is trained on
+	 */
+	unsigned int surrogateHistory;
+
+	/**
+	 * Island model: port on which migrants from other islands are received,
+	 * 0 if this island does not receive any
+	 */
+	int islandPort;
+
+	/**
+	 * Island model: islands the best individuals are sent to
+	 */
+	std::vector<std::pair<std::string, int> > migrationTargets;
+
+	/**
+	 * Island model: number of generations between migrations
+	 */
+	unsigned int migrationInterval;
+
+	/**
+	 * Island model: number of best individuals sent at each migration
+	 */
+	unsigned int migrationSize;
+
 	// BRAIN EVOLUTION PARAMS
 	// ========================================================================
 
@@ -278,6 +346,40 @@ typedef struct EvolverConfiguration {
 	 */
 	std::string neatParamsFile;
 
+	/**
+	 * CMA-ES: initial step size, relative to the range of brain parameters
+	 */
+	double cmaesSigma;
+
+	/**
+	 * CMA-ES: maximum number of restarts, each doubling the number of samples
+	 */
+	unsigned int cmaesMaxRestarts;
+
+	/**
+	 * MAP-Elites: an axis of the archive grid
+	 */
+	struct MapElitesDescriptor {
+		/**
+		 * parts, limbs, motors, sensors, hidden or objective<k>
+		 */
+		std::string name;
+		double min;
+		double max;
+		unsigned int bins;
+	};
+
+	/**
+	 * MAP-Elites: axes of the archive grid
+	 */
+	std::vector<MapElitesDescriptor> mapElitesDescriptors;
+
+	/**
+	 * MAP-Elites: archive journal of a previous run to resume from, empty if
+	 * none
+	 */
+	std::string mapElitesArchive;
+
 	double pOscillatorNeuron;
 
 	double pAddHiddenNeuron;
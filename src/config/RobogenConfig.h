@@ -50,6 +50,10 @@ public:
 		REMOVE_OBSTACLES, CONSTRAINT_VIOLATION, ELEVATE_ROBOT
 	};
 
+	enum SolverTypes {
+		STEP_SOLVER, QUICKSTEP_SOLVER
+	};
+
 	/**
 	 * Initializes a robogen config object from configuration parameters
 	 */
@@ -67,7 +71,9 @@ public:
 			bool capAcceleration, float maxLinearAcceleration,
 			float maxAngularAcceleration, int maxDirectionShiftsPerSecond,
 			osg::Vec3 gravity, bool disallowObstacleCollisions,
-			unsigned int obstacleOverlapPolicy) :
+			unsigned int obstacleOverlapPolicy, unsigned int solver,
+			int quickStepIterations, float quickStepSOR,
+			unsigned int odeThreads, float settleTime, float settleVelocity) :
 				scenario_(scenario), scenarioFile_(scenarioFile),
 				timeSteps_(timeSteps),
 				timeStepLength_(timeStepLength),
@@ -86,7 +92,10 @@ public:
 				maxDirectionShiftsPerSecond_(maxDirectionShiftsPerSecond),
 				gravity_(gravity),
 				disallowObstacleCollisions_(disallowObstacleCollisions),
-				obstacleOverlapPolicy_(obstacleOverlapPolicy) {
+				obstacleOverlapPolicy_(obstacleOverlapPolicy),
+				solver_(solver), quickStepIterations_(quickStepIterations),
+				quickStepSOR_(quickStepSOR), odeThreads_(odeThreads),
+				settleTime_(settleTime), settleVelocity_(settleVelocity) {
 
 		simulationTime_ = timeSteps * timeStepLength;
 
@@ -263,6 +272,52 @@ public:
 		return obstacleOverlapPolicy_;
 	}
 
+	/**
+	 * @return the ODE solver used to step the world (see SolverTypes)
+	 */
+	unsigned int getSolver() const {
+		return solver_;
+	}
+
+	/**
+	 * @return number of iterations of the QuickStep solver
+	 */
+	int getQuickStepIterations() const {
+		return quickStepIterations_;
+	}
+
+	/**
+	 * @return successive over-relaxation parameter of the QuickStep solver
+	 */
+	float getQuickStepSOR() const {
+		return quickStepSOR_;
+	}
+
+	/**
+	 * @return number of threads used by ODE to step the world,
+	 * 		1 if stepped by the simulation thread only
+	 */
+	unsigned int getOdeThreads() const {
+		return odeThreads_;
+	}
+
+	/**
+	 * @return maximum time (s) spent letting the robot settle on the ground,
+	 * 		with its brain disabled, before the simulation starts.
+	 * 		0 if there is no settle phase
+	 */
+	float getSettleTime() const {
+		return settleTime_;
+	}
+
+	/**
+	 * @return linear (m/s) and angular (rad/s) speed below which the robot
+	 * 		bodies are considered settled
+	 */
+	float getSettleVelocity() const {
+		return settleVelocity_;
+	}
+
 	/**
 	 * Convert configuration into configuration message.
 	 */
@@ -284,6 +339,12 @@ public:
 		ret.set_gravityz(gravity_.z());
 		ret.set_disallowobstaclecollisions(disallowObstacleCollisions_);
 		ret.set_obstacleoverlappolicy(obstacleOverlapPolicy_);
+		ret.set_solver(solver_);
+		ret.set_quickstepiterations(quickStepIterations_);
+		ret.set_quickstepsor(quickStepSOR_);
+		ret.set_odethreads(odeThreads_);
+		ret.set_settletime(settleTime_);
+		ret.set_settlevelocity(settleVelocity_);
 
 		terrain_->serialize(ret);
 
@@ -408,6 +469,36 @@ private:
 	 * initial AABB
 	 */
 	unsigned int obstacleOverlapPolicy_;
+
+	/**
+	 * ODE solver: exact (dWorldStep) or iterative (dWorldQuickStep)
+	 */
+	unsigned int solver_;
+
+	/**
+	 * Number of iterations of the QuickStep solver
+	 */
+	int quickStepIterations_;
+
+	/**
+	 * Successive over-relaxation parameter of the QuickStep solver
+	 */
+	float quickStepSOR_;
+
+	/**
+	 * Number of threads used by ODE to step the world
+	 */
+	unsigned int odeThreads_;
+
+	/**
+	 * Maximum duration of the settle phase, 0 to disable it
+	 */
+	float settleTime_;
+
+	/**
+	 * Speed below which the robot is considered settled
+	 */
+	float settleVelocity_;
 };
 
 }
@@ -7,6 +7,7 @@
 
 #include "evolution/engine/BodyVerifier.h"
 #include "Robot.h"
+#include "Simulator.h"
 #include "utils/RobogenUtils.h"
 #include "model/Model.h"
 
@@ -65,8 +66,11 @@ bool BodyVerifier::verify(const RobotRepresentation &robotRep, int &errorCode,
 	bool success = true;
 	errorCode = INTERNAL_ERROR;
 
-	// Initialize ODE
-	dInitODE();
+	// Initialize ODE, simulations may be running on other threads
+	{
+		boost::mutex::scoped_lock lock(getOdeInitMutex());
+		dInitODE();
+	}
 	dWorldID odeWorld = dWorldCreate();
 	dWorldSetGravity(odeWorld, 0, 0, 0);
 	dSpaceID odeSpace = dHashSpaceCreate(0);
@@ -223,7 +227,10 @@ bool BodyVerifier::verify(const RobotRepresentation &robotRep, int &errorCode,
 	robot.reset();
 	dSpaceDestroy(odeSpace);
 	dWorldDestroy(odeWorld);
-	dCloseODE();
+	{
+		boost::mutex::scoped_lock lock(getOdeInitMutex());
+		dCloseODE();
+	}
 	return success;
 }
 
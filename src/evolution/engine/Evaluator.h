@@ -0,0 +1,168 @@
+/*
+ * @(#) Evaluator.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_EVALUATOR_H_
+#define ROBOGEN_EVALUATOR_H_
+
+#include <queue>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "config/RobogenConfig.h"
+#include "evolution/representation/RobotRepresentation.h"
+
+namespace robogen {
+
+/**
+ * Source of individuals evaluated as they come, without a generation barrier:
+ * evaluators pull individuals until the stream runs dry, and report each of
+ * them back as soon as its evaluation completes. Calls to next() and
+ * completed() are serialized by the evaluator, prepare() runs concurrently.
+ */
+class EvaluationStream {
+public:
+	/**
+	 * @return the next individual to evaluate, or an empty pointer once the
+	 * stream is exhausted
+	 */
+	virtual boost::shared_ptr<RobotRepresentation> next() = 0;
+
+	/**
+	 * Called by the thread that got an individual from next(), outside of
+	 * the serialized calls, so that expensive work such as creating offspring
+	 * does not hold up the other evaluation threads
+	 * @param robot individual returned by next()
+	 * @return the individual to evaluate in its place
+	 */
+	virtual boost::shared_ptr<RobotRepresentation> prepare(
+			boost::shared_ptr<RobotRepresentation> robot) {
+		return robot;
+	}
+
+	/**
+	 * Called once the evaluation of an individual returned by next() is done
+	 */
+	virtual void completed(boost::shared_ptr<RobotRepresentation> robot) = 0;
+
+	virtual ~EvaluationStream() {
+
+	}
+};
+
+/**
+ * Stream over a fixed batch of individuals
+ */
+class BatchStream : public EvaluationStream {
+public:
+	BatchStream(
+			const std::vector<boost::shared_ptr<RobotRepresentation> > &robots) {
+		for (unsigned int i = 0; i < robots.size(); i++) {
+			queue_.push(robots[i]);
+		}
+	}
+
+	virtual boost::shared_ptr<RobotRepresentation> next() {
+		if (queue_.empty()) {
+			return boost::shared_ptr<RobotRepresentation>();
+		}
+		boost::shared_ptr<RobotRepresentation> robot = queue_.front();
+		queue_.pop();
+		return robot;
+	}
+
+	virtual void completed(boost::shared_ptr<RobotRepresentation> robot) {
+
+	}
+
+private:
+	std::queue<boost::shared_ptr<RobotRepresentation> > queue_;
+};
+
+/**
+ * Evaluator interface definition: computes the fitness of individuals
+ */
+class Evaluator {
+public:
+	Evaluator() : simulationTime_(0), startPositions_(0) {
+
+	}
+
+	/**
+	 * Evaluate the given individuals. Once done, each of them is evaluated
+	 * and holds its fitness (unless the evaluation is asynchronous, as in the
+	 * javascript build).
+	 * @param robots the individuals to evaluate
+	 * @param robotConf the simulator configuration
+	 */
+	virtual void evaluate(
+			const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+			boost::shared_ptr<RobogenConfig> robotConf) = 0;
+
+	/**
+	 * Evaluate the individuals of a stream, keeping every worker busy until
+	 * the stream is exhausted
+	 * @param stream source of the individuals, notified of each completion
+	 * @param robotConf the simulator configuration
+	 */
+	virtual void evaluate(EvaluationStream &stream,
+			boost::shared_ptr<RobogenConfig> robotConf) = 0;
+
+	/**
+	 * Evaluate the next individuals at reduced fidelity, or back at full
+	 * fidelity when both parameters are 0
+	 * @param simulationTime simulated time (s), 0 for the configured one
+	 * @param startPositions number of start positions to use, 0 for all
+	 */
+	void setFidelity(float simulationTime, unsigned int startPositions) {
+		simulationTime_ = simulationTime;
+		startPositions_ = startPositions;
+	}
+
+	/**
+	 * @return true if evaluations are done at reduced fidelity
+	 */
+	bool isLowFidelity() const {
+		return simulationTime_ > 0 || startPositions_ > 0;
+	}
+
+	virtual ~Evaluator() {
+
+	}
+
+protected:
+	/**
+	 * Simulation time override (s), 0 if none
+	 */
+	float simulationTime_;
+
+	/**
+	 * Start positions override, 0 if none
+	 */
+	unsigned int startPositions_;
+};
+
+} /* namespace robogen */
+#endif /* ROBOGEN_EVALUATOR_H_ */
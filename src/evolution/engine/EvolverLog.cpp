@@ -36,10 +36,15 @@
 #include "evolution/engine/EvolverLog.h"
 #include "evolution/engine/Population.h"
 #include "utils/json2pb/json2pb.h"
+#include "utils/network/ProtobufPacket.h"
 
 namespace robogen {
 
 #define BAS_LOG_FILE "BestAvgStd.txt"
+#define PROFILE_LOG_FILE "SimulationProfile.txt"
+#define SURROGATE_LOG_FILE "SurrogateError.txt"
+#define MAP_ELITES_LOG_FILE "MapElites.txt"
+#define MAP_ELITES_ARCHIVE_FILE "MapElitesArchive.dat"
 #define GENERATION_BEST_PREFIX "GenerationBest-"
 
 EvolverLog::EvolverLog(){
@@ -100,6 +105,51 @@ bool EvolverLog::init(boost::shared_ptr<EvolverConfiguration> conf,
 		return false;
 	}
 
+	// open simulation profile log, one line per generation
+	std::string profileLogPath = logPath_ + "/" + PROFILE_LOG_FILE;
+	profile_.open(profileLogPath.c_str());
+	if (!profile_.is_open()){
+		std::cout << "Can't open simulation profile log file" << std::endl;
+		return false;
+	}
+	profile_ << "# generation simulations steps contacts maxContacts";
+	for (unsigned int i = 0; i < SimulationProfile::NUM_PHASES; ++i) {
+		profile_ << " " << SimulationProfile::getPhaseName(i) << "Seconds "
+				<< SimulationProfile::getPhaseName(i) << "Calls";
+	}
+	profile_ << std::endl;
+
+	// open surrogate log, one line per generation
+	if (conf->surrogateOversampling > 1) {
+		std::string surrogateLogPath = logPath_ + "/" + SURROGATE_LOG_FILE;
+		surrogate_.open(surrogateLogPath.c_str());
+		if (!surrogate_.is_open()){
+			std::cout << "Can't open surrogate log file" << std::endl;
+			return false;
+		}
+		surrogate_ << "# generation samples predicted meanAbsoluteError "
+				<< "correlation" << std::endl;
+	}
+
+	// open MAP-Elites logs, one line per checkpoint and the archive journal
+	if (conf->evolutionaryAlgorithm == EvolverConfiguration::MAP_ELITES) {
+		std::string mapElitesLogPath = logPath_ + "/" + MAP_ELITES_LOG_FILE;
+		mapElites_.open(mapElitesLogPath.c_str());
+		if (!mapElites_.is_open()){
+			std::cout << "Can't open MAP-Elites log file" << std::endl;
+			return false;
+		}
+		mapElites_ << "# checkpoint evaluations filled coverage qdScore best"
+				<< std::endl;
+
+		std::string archivePath = logPath_ + "/" + MAP_ELITES_ARCHIVE_FILE;
+		archive_.open(archivePath.c_str(), std::ios::out | std::ios::binary);
+		if (!archive_.is_open()){
+			std::cout << "Can't open MAP-Elites archive file" << std::endl;
+			return false;
+		}
+	}
+
 	// copy evolution configuration file
 	copyConfFile(conf->confFileName);
 	// copy simulator configuration file
@@ -187,6 +237,90 @@ bool EvolverLog::logGeneration(int generation, Population &population) {
 	return true;
 }
 
+bool EvolverLog::logProfile(int generation,
+		const SimulationProfile &profile) {
+
+	profile_ << generation << " " << profile.getEvaluations() << " "
+			<< profile.getSteps() << " " << profile.getContacts() << " "
+			<< profile.getMaxContacts();
+	for (unsigned int i = 0; i < SimulationProfile::NUM_PHASES; ++i) {
+		profile_ << " " << profile.getSeconds(i) << " " << profile.getCalls(i);
+	}
+	profile_ << std::endl;
+	return profile_.good();
+}
+
+bool EvolverLog::logSurrogate(int generation, unsigned int samples,
+		unsigned int predicted, double meanAbsoluteError,
+		double correlation) {
+
+	surrogate_ << generation << " " << samples << " " << predicted << " "
+			<< meanAbsoluteError << " " << correlation << std::endl;
+	return surrogate_.good();
+}
+
+bool EvolverLog::logElite(boost::shared_ptr<RobotRepresentation> robot) {
+
+	boost::shared_ptr<robogenMessage::MapElitesElite> elite(
+			new robogenMessage::MapElitesElite());
+	*elite->mutable_robot() = robot->serialize();
+	elite->set_fitness(robot->getFitness());
+	const std::vector<double> &objectives = robot->getObjectives();
+	for (unsigned int i = 0; i < objectives.size(); ++i) {
+		elite->add_objectives(objectives[i]);
+	}
+
+	ProtobufPacket<robogenMessage::MapElitesElite> packet(elite);
+	std::vector<unsigned char> buffer;
+	if (!packet.forge(buffer)) {
+		std::cout << "Can't serialize MAP-Elites elite" << std::endl;
+		return false;
+	}
+	archive_.write((const char *) &buffer[0], buffer.size());
+	return archive_.good();
+}
+
+bool EvolverLog::logArchive(int batch, unsigned int evaluations,
+		unsigned int filled, double coverage, double qdScore,
+		boost::shared_ptr<RobotRepresentation> best) {
+
+	// elites written so far survive a crash
+	archive_.flush();
+
+	std::cout << "Checkpoint " << batch << ", Evaluations: " << evaluations
+			<< " Filled cells: " << filled << " Coverage: " << coverage
+			<< " QD-score: " << qdScore << " Best: " << best->getFitness()
+			<< std::endl;
+	mapElites_ << batch << " " << evaluations << " " << filled << " "
+			<< coverage << " " << qdScore << " " << best->getFitness()
+			<< std::endl;
+
+	#ifndef FAKEROBOTREPRESENTATION_H
+	std::stringstream ss;
+	ss << logPath_ + "/" + GENERATION_BEST_PREFIX << batch << ".json";
+	saveRobotJson(best, ss.str());
+	#endif
+
+	return archive_.good() && mapElites_.good();
+}
+
+void EvolverLog::logElites(const std::map<boost::uint64_t,
+		boost::shared_ptr<RobotRepresentation> > &archive) {
+
+	if (!saveAll_) {
+		return;
+	}
+
+	#ifndef FAKEROBOTREPRESENTATION_H
+	for (std::map<boost::uint64_t, boost::shared_ptr<RobotRepresentation> >::
+			const_iterator it = archive.begin(); it != archive.end(); ++it) {
+		std::stringstream ss;
+		ss << logPath_ + "/Elite-" << it->first << ".json";
+		saveRobotJson(it->second, ss.str());
+	}
+	#endif
+}
+
 void EvolverLog::copyConfFile(std::string fileName) {
 	if (fileName.length() == 0)
 		return;
@@ -30,6 +30,8 @@
 #define EVOLVERLOG_H_
 
 #include <fstream>
+#include <map>
+#include <boost/cstdint.hpp>
 #include "evolution/engine/Population.h"
 #include "config/EvolverConfiguration.h"
 #include "config/RobogenConfig.h"
@@ -72,6 +74,58 @@ public:
 	 */
 	bool logGeneration(int generation, Population &population);
 
+	/**
+	 * Logs the simulation profile of the evaluations of a generation, writing
+	 * one line into SimulationProfile.txt
+	 * @param generation number of current generation
+	 * @param profile summed profiles of the individuals evaluated for this
+	 * 			generation
+	 */
+	bool logProfile(int generation, const SimulationProfile &profile);
+
+	/**
+	 * Logs how well the surrogate model predicted the fitness of the
+	 * offspring of a generation, writing one line into SurrogateError.txt
+	 * @param generation number of current generation
+	 * @param samples number of evaluations the model was trained on
+	 * @param predicted number of offspring whose fitness was predicted
+	 * @param meanAbsoluteError mean absolute prediction error
+	 * @param correlation correlation between predicted and real fitness
+	 */
+	bool logSurrogate(int generation, unsigned int samples,
+			unsigned int predicted, double meanAbsoluteError,
+			double correlation);
+
+	/**
+	 * Appends a new elite of the MAP-Elites archive to the archive journal
+	 * MapElitesArchive.dat, a sequence of length-prefixed MapElitesElite
+	 * messages from which a run can be resumed
+	 * @param robot the evaluated individual that became an elite
+	 */
+	bool logElite(boost::shared_ptr<RobotRepresentation> robot);
+
+	/**
+	 * Checkpoints the MAP-Elites archive: flushes the journal, writes one
+	 * line into MapElites.txt and the best elite to file
+	 * @param batch number of the checkpoint, used as generation number
+	 * @param evaluations number of evaluations completed so far
+	 * @param filled number of filled cells
+	 * @param coverage fraction of the cells that are filled
+	 * @param qdScore sum of the fitness of the elites
+	 * @param best best elite
+	 */
+	bool logArchive(int batch, unsigned int evaluations, unsigned int filled,
+			double coverage, double qdScore,
+			boost::shared_ptr<RobotRepresentation> best);
+
+	/**
+	 * Saves every elite of the MAP-Elites archive to file, if saving all
+	 * individuals
+	 * @param archive elites by cell
+	 */
+	void logElites(const std::map<boost::uint64_t,
+			boost::shared_ptr<RobotRepresentation> > &archive);
+
 private:
 	/**
 	 * Log directory
@@ -81,6 +135,22 @@ private:
 	 * File stream to BestAvgStd.txt
 	 */
 	std::ofstream bestAvgStd_;
+	/**
+	 * File stream to SimulationProfile.txt
+	 */
+	std::ofstream profile_;
+	/**
+	 * File stream to SurrogateError.txt
+	 */
+	std::ofstream surrogate_;
+	/**
+	 * File stream to MapElites.txt
+	 */
+	std::ofstream mapElites_;
+	/**
+	 * File stream to the MAP-Elites archive journal
+	 */
+	std::ofstream archive_;
 	/**
 	 * Flag to specify whether to save all individuals (default is just to save
 	 * the best of each generation).
@@ -28,14 +28,8 @@
 
 #include "evolution/engine/IndividualContainer.h"
 #include <algorithm>
-#include <queue>
-#include <boost/thread.hpp>
-#include <boost/thread/mutex.hpp>
-#ifdef EMSCRIPTEN
-#include <utils/network/FakeJSSocket.h>
-#include <boost/lexical_cast.hpp>
-void sendJSEvent(std::string name, std::string jsonData);
-#endif
+#include <cmath>
+#include <iostream>
 
 namespace robogen {
 
@@ -47,112 +41,90 @@ IndividualContainer::~IndividualContainer() {
 	// TODO Auto-generated destructor stub
 }
 
-/**
- * Thread function assigned to a socket
- * @param indiQueue queue of Individuals to be evaluated
- * @param queueMutex mutex for access to queue
- * @param socket socket to simulator
- * @param confFile simulator configuration file to be used for evaluations
- */
-void evaluationThread(
-		std::queue<boost::shared_ptr<RobotRepresentation> >& indiQueue,
-		boost::mutex& queueMutex, Socket& socket,
-		boost::shared_ptr<RobogenConfig> robotConf) {
-
-	while (true) {
-
-		boost::mutex::scoped_lock lock(queueMutex);
-		if (indiQueue.empty()) {
-			return;
-		}
-
-		boost::shared_ptr<RobotRepresentation> current = indiQueue.front();
-		indiQueue.pop();
-		std::cout << "." << std::flush;
-		lock.unlock();
-
-		current->evaluate(&socket, robotConf);
+bool robotFitnessComparator(const boost::shared_ptr<RobotRepresentation>& a,
+		const boost::shared_ptr<RobotRepresentation>& b) {
 
+	if (a->isLowFidelity() != b->isLowFidelity()) {
+		return b->isLowFidelity();
 	}
+	return a->getFitness() > b->getFitness();
 
 }
 
 void IndividualContainer::evaluate(boost::shared_ptr<RobogenConfig> robotConf,
-		std::vector<Socket*> &sockets) {
+		Evaluator &evaluator) {
 
-	// 1. Create mutexed queue of Individual pointers
-	std::queue<boost::shared_ptr<RobotRepresentation> > indiQueue;
-	boost::mutex queueMutex;
+	std::vector<boost::shared_ptr<RobotRepresentation> > queued;
 	for (unsigned int i = 0; i < this->size(); i++) {
 		if (!this->at(i)->isEvaluated()) {
-			indiQueue.push(this->at(i));
+			queued.push_back(this->at(i));
 		}
 	}
-	std::cout << indiQueue.size() << " individuals queued for evaluation."
+	std::cout << queued.size() << " individuals queued for evaluation."
 			<< " Progress:" << std::endl;
 
-#ifdef EMSCRIPTEN
-	std::string message = "[";
-	bool firstIndividual = true;
-	int sent = 0;
-	while (!indiQueue.empty()){
-		++sent;
-		FakeJSSocket socket;
-		boost::shared_ptr<RobotRepresentation> currentRobot = indiQueue.front();
-		indiQueue.pop();
-		currentRobot->evaluate(&socket, robotConf);
-		int ptrToIndividual = (int) currentRobot.get();
-		if (!firstIndividual) {
-			message += ",";
-		} else {
-			firstIndividual = false;
-		}
-		message += "{ptr:";
-		message += boost::lexical_cast<std::string>(ptrToIndividual);
-		message += ", packet : [";
-		bool firstByte = true;
-		std::vector<unsigned char> content = socket.getContent();
-		for (size_t k = 0 ; k < content.size(); ++k) {
-			if (!firstByte) {
-				message += ",";
-			} else {
-				firstByte = false;
-			}
-			message += boost::lexical_cast<std::string>((int) content[k]);
-		}
-		message += "]}";
+	evaluator.evaluate(queued, robotConf);
+
+#ifndef EMSCRIPTEN
+	profile_.reset();
+	for (unsigned int i = 0; i < queued.size(); ++i) {
+		profile_.merge(queued[i]->getProfile());
 	}
-	message += "]";
-	sendJSEvent("needsEvaluation", message);
-	std::cout << sent << " inidividual sent to the javascript scheduler" << std::endl;
+#endif
 
-#else
+	evaluated_ = true;
+}
 
-	// 2. Prepare thread structure
-	boost::thread_group evaluators;
+void IndividualContainer::evaluate(boost::shared_ptr<RobogenConfig> robotConf,
+		Evaluator &evaluator, boost::shared_ptr<EvolverConfiguration> conf) {
 
-	// 3. Launch threads
-	for (unsigned int i = 0; i < sockets.size(); i++) {
-		evaluators.add_thread(
-				new boost::thread(evaluationThread, boost::ref(indiQueue), boost::ref(queueMutex),
-						boost::ref(*sockets[i]), robotConf));
-	}
+#ifndef EMSCRIPTEN // evaluations are asynchronous, can not be staged
+	if (conf->lowFidelitySimulationTime > 0 ||
+			conf->lowFidelityStartPositions > 0) {
 
-	// 4. Join threads. Individuals are now evaluated.
-	evaluators.join_all();
+		std::vector<boost::shared_ptr<RobotRepresentation> > queued;
+		for (unsigned int i = 0; i < this->size(); i++) {
+			if (!this->at(i)->isEvaluated()) {
+				queued.push_back(this->at(i));
+			}
+		}
 
-	// newline after per-individual dots
-	std::cout << std::endl;
-#endif
+		// 1. everyone at low fidelity
+		std::cout << queued.size() << " individuals queued for low fidelity "
+				<< "evaluation. Progress:" << std::endl;
+		evaluator.setFidelity(conf->lowFidelitySimulationTime,
+				conf->lowFidelityStartPositions);
+		evaluator.evaluate(queued, robotConf);
+		evaluator.setFidelity(0, 0);
+
+		profile_.reset();
+		for (unsigned int i = 0; i < queued.size(); ++i) {
+			profile_.merge(queued[i]->getProfile());
+		}
 
-	evaluated_ = true;
-}
+		// 2. the best ones again at full fidelity
+		std::sort(queued.begin(), queued.end(), robotFitnessComparator);
+		unsigned int nPromoted = std::ceil(conf->promotedFraction *
+				queued.size());
+		queued.resize(nPromoted);
+		std::cout << queued.size() << " individuals promoted to full "
+				<< "fidelity evaluation. Progress:" << std::endl;
+		evaluator.evaluate(queued, robotConf);
+
+		for (unsigned int i = 0; i < queued.size(); ++i) {
+			profile_.merge(queued[i]->getProfile());
+		}
 
-bool robotFitnessComparator(const boost::shared_ptr<RobotRepresentation>& a,
-		const boost::shared_ptr<RobotRepresentation>& b) {
+		evaluated_ = true;
+		return;
+	}
+#endif
 
-	return a->getFitness() > b->getFitness();
+	evaluate(robotConf, evaluator);
+}
 
+const SimulationProfile &IndividualContainer::getProfile() const {
+	return profile_;
 }
 
 void IndividualContainer::sort(bool forceSort) {
@@ -30,11 +30,22 @@
 #define INDIVIDUALCONTAINER_H_
 
 #include <vector>
+#include "config/EvolverConfiguration.h"
 #include "config/RobogenConfig.h"
 #include "evolution/representation/RobotRepresentation.h"
+#include "evolution/engine/Evaluator.h"
 
 namespace robogen {
 
+/**
+ * Orders individuals from best to worst. Individuals that kept a low
+ * fidelity fitness come after all fully evaluated ones, as the two fitness
+ * scales can not be compared.
+ * @return true if a ranks before b
+ */
+bool robotFitnessComparator(const boost::shared_ptr<RobotRepresentation>& a,
+		const boost::shared_ptr<RobotRepresentation>& b);
+
 // TODO transform to shared pointer?
 
 class IndividualContainer: public std::vector<boost::shared_ptr<RobotRepresentation> > {
@@ -45,13 +56,26 @@ public:
 	virtual ~IndividualContainer();
 
 	/**
-	 * Evaluate the population using the given scenario config and the given
-	 * sockets to transmit the robot to simulator instances in parallel. Then
-	 * order the population by fitness.
+	 * Evaluate the individuals that are not evaluated yet using the given
+	 * scenario config and evaluator (simulator servers or in-process
+	 * simulation).
+	 * @param robotConfig the robot configuration
+	 * @param evaluator the evaluation backend
+	 */
+	void evaluate(boost::shared_ptr<RobogenConfig> robotConfig, Evaluator &evaluator);
+
+	/**
+	 * Evaluate the individuals that are not evaluated yet, in two stages if
+	 * the evolver configuration asks for multi-fidelity evaluation: all of
+	 * them at low fidelity first, then only the best ones at full fidelity.
+	 * The others keep their low fidelity fitness, and are ranked below the
+	 * promoted ones by selection and replacement.
 	 * @param robotConfig the robot configuration
-	 * @param sockets a vector of Socket pointers. On each should be a simulator
+	 * @param evaluator the evaluation backend
+	 * @param conf the evolver configuration
 	 */
-	void evaluate(boost::shared_ptr<RobogenConfig> robotConfig, std::vector<Socket*> &sockets);
+	void evaluate(boost::shared_ptr<RobogenConfig> robotConfig,
+			Evaluator &evaluator, boost::shared_ptr<EvolverConfiguration> conf);
 
 	/**
 	 * Sorts individuals from best to worst.
@@ -69,6 +93,12 @@ public:
 	 */
 	bool areEvaluated() const;
 
+	/**
+	 * @return the simulation profiles of the individuals evaluated by the
+	 * 		last call to evaluate(), summed up
+	 */
+	const SimulationProfile &getProfile() const;
+
 
 protected:
 
@@ -78,6 +108,8 @@ private:
 
 	bool sorted_;
 
+	SimulationProfile profile_;
+
 };
 
 } /* namespace robogen */
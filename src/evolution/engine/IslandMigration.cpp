@@ -0,0 +1,203 @@
+/*
+ * @(#) IslandMigration.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef EMSCRIPTEN
+
+#include "evolution/engine/IslandMigration.h"
+#include <algorithm>
+#include <iostream>
+#include "utils/network/ProtobufPacket.h"
+
+namespace robogen {
+
+IslandMigration::IslandMigration(
+		boost::shared_ptr<EvolverConfiguration> conf) :
+		conf_(conf), inbox_(new Inbox()) {
+}
+
+IslandMigration::~IslandMigration() {
+	// the listener blocks in accept, and keeps its own reference to the
+	// inbox, so it is left running until the process exits
+	if (listener_.joinable()) {
+		listener_.detach();
+	}
+}
+
+bool IslandMigration::init() {
+	if (conf_->islandPort == 0) {
+		return true;
+	}
+	if (!inbox_->socket.create(conf_->islandPort)) {
+		std::cerr << "Cannot listen for migrants on port "
+				<< conf_->islandPort << std::endl;
+		return false;
+	}
+	listener_ = boost::thread(&IslandMigration::listen, inbox_);
+	return true;
+}
+
+void IslandMigration::listen(boost::shared_ptr<Inbox> inbox) {
+
+	while (inbox->socket.accept()) {
+
+		// islands send one packet per connection, but do not rely on it
+		while (true) {
+			ProtobufPacket<robogenMessage::Migrants> packet;
+			try {
+				std::vector<unsigned char> headerBuffer;
+				inbox->socket.read(headerBuffer,
+						ProtobufPacket<robogenMessage::Migrants>::HEADER_SIZE);
+				unsigned int packetSize = packet.decodeHeader(headerBuffer);
+
+				std::vector<unsigned char> payloadBuffer;
+				inbox->socket.read(payloadBuffer, packetSize);
+				packet.decodePayload(payloadBuffer);
+			} catch (boost::system::system_error& e) {
+				// sender closed the connection
+				break;
+			}
+
+			boost::mutex::scoped_lock lock(inbox->mutex);
+			inbox->migrants.push_back(*packet.getMessage());
+		}
+	}
+}
+
+void IslandMigration::emigrate(Population &population,
+		unsigned int generation) {
+
+	if (conf_->migrationTargets.empty()) {
+		return;
+	}
+
+	population.sort();
+	boost::shared_ptr<robogenMessage::Migrants> migrants(
+			new robogenMessage::Migrants());
+	migrants->set_generation(generation);
+	for (unsigned int i = 0; i < population.size() &&
+			(unsigned int) migrants->robot_size() < conf_->migrationSize;
+			++i) {
+		// only send individuals with a comparable fitness
+		if (population[i]->isLowFidelity()) {
+			continue;
+		}
+		*migrants->add_robot() = population[i]->serialize();
+		migrants->add_fitness(population[i]->getFitness());
+	}
+
+	ProtobufPacket<robogenMessage::Migrants> packet;
+	packet.setMessage(migrants);
+	std::vector<unsigned char> sendBuffer;
+	packet.forge(sendBuffer);
+
+	for (unsigned int i = 0; i < conf_->migrationTargets.size(); ++i) {
+		TcpSocket socket;
+		if (!socket.open(conf_->migrationTargets[i].first,
+				conf_->migrationTargets[i].second)) {
+			std::cerr << "Warning: cannot reach island "
+					<< conf_->migrationTargets[i].first << ":"
+					<< conf_->migrationTargets[i].second
+					<< ", skipping it this time" << std::endl;
+			continue;
+		}
+		try {
+			socket.write(sendBuffer);
+		} catch (boost::system::system_error& e) {
+			std::cerr << "Warning: sending migrants to island "
+					<< conf_->migrationTargets[i].first << ":"
+					<< conf_->migrationTargets[i].second << " failed: "
+					<< e.what() << std::endl;
+		}
+		socket.close();
+	}
+
+	std::cout << "Sent " << migrants->robot_size() << " migrants to "
+			<< conf_->migrationTargets.size() << " islands" << std::endl;
+}
+
+/**
+ * A received migrant: its fitness and its serialization
+ */
+typedef std::pair<double, const robogenMessage::Robot*> Migrant;
+
+bool migrantFitnessComparator(const Migrant &a, const Migrant &b) {
+	return a.first > b.first;
+}
+
+unsigned int IslandMigration::immigrate(Population &population) {
+
+	std::vector<robogenMessage::Migrants> received;
+	{
+		boost::mutex::scoped_lock lock(inbox_->mutex);
+		received.swap(inbox_->migrants);
+	}
+
+	std::vector<Migrant> migrants;
+	for (unsigned int i = 0; i < received.size(); ++i) {
+		for (int j = 0; j < received[i].robot_size() &&
+				j < received[i].fitness_size(); ++j) {
+			migrants.push_back(Migrant(received[i].fitness(j),
+					&received[i].robot(j)));
+		}
+	}
+	if (migrants.empty()) {
+		return 0;
+	}
+	std::sort(migrants.begin(), migrants.end(), migrantFitnessComparator);
+
+	unsigned int accepted = 0;
+	population.sort();
+	for (unsigned int i = 0; i < migrants.size(); ++i) {
+		if (population.empty() ||
+				migrants[i].first <= population.back()->getFitness()) {
+			// the remaining migrants are not fitter either
+			break;
+		}
+
+		boost::shared_ptr<RobotRepresentation> robot(
+				new RobotRepresentation());
+		if (!robot->init(*migrants[i].second)) {
+			std::cerr << "Warning: could not decode a migrant, discarding it"
+					<< std::endl;
+			continue;
+		}
+		robot->setEvaluationResult(migrants[i].first, std::vector<double>(),
+				SimulationProfile(), false);
+
+		population.back() = robot;
+		population.sort(true);
+		++accepted;
+	}
+
+	std::cout << accepted << " of " << migrants.size()
+			<< " migrants entered the population" << std::endl;
+	return accepted;
+}
+
+} /* namespace robogen */
+
+#endif /* EMSCRIPTEN */
@@ -0,0 +1,121 @@
+/*
+ * @(#) IslandMigration.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_ISLAND_MIGRATION_H_
+#define ROBOGEN_ISLAND_MIGRATION_H_
+
+#ifndef EMSCRIPTEN
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include "config/EvolverConfiguration.h"
+#include "evolution/engine/Population.h"
+#include "utils/network/TcpSocket.h"
+#include "robogen.pb.h"
+
+namespace robogen {
+
+/**
+ * Island model: exchanges individuals between evolver processes, each
+ * evolving its own population.
+ *
+ * Every island listens on its islandPort for migrants, and sends its best
+ * individuals to the islands listed as migrationTarget, so the targets
+ * define the topology (e.g. each island naming the next one gives a ring).
+ * Islands never wait for each other: migrants are received in the
+ * background and integrated at the next migration of the receiving island.
+ */
+class IslandMigration {
+public:
+	/**
+	 * @param conf evolver configuration, with the migration parameters
+	 */
+	IslandMigration(boost::shared_ptr<EvolverConfiguration> conf);
+
+	virtual ~IslandMigration();
+
+	/**
+	 * Starts listening for migrants, if an islandPort is configured
+	 * @return true if the port could be opened
+	 */
+	bool init();
+
+	/**
+	 * Sends copies of the migrationSize best individuals of the population
+	 * to every target island. Islands that cannot be reached are skipped.
+	 * @param population evaluated population
+	 * @param generation current generation
+	 */
+	void emigrate(Population &population, unsigned int generation);
+
+	/**
+	 * Integrates the migrants received since the last call: each one
+	 * replaces the worst individual of the population, if it is fitter.
+	 * @param population evaluated population
+	 * @return number of migrants that entered the population
+	 */
+	unsigned int immigrate(Population &population);
+
+private:
+	/**
+	 * Listening socket and migrants received so far, shared with the
+	 * listening thread
+	 */
+	struct Inbox {
+		TcpSocket socket;
+		boost::mutex mutex;
+		std::vector<robogenMessage::Migrants> migrants;
+	};
+
+	/**
+	 * Thread function receiving migrants until the socket is closed
+	 */
+	static void listen(boost::shared_ptr<Inbox> inbox);
+
+	/**
+	 * Evolver configuration
+	 */
+	boost::shared_ptr<EvolverConfiguration> conf_;
+
+	/**
+	 * Received migrants
+	 */
+	boost::shared_ptr<Inbox> inbox_;
+
+	/**
+	 * Thread receiving migrants
+	 */
+	boost::thread listener_;
+};
+
+} /* namespace robogen */
+
+#endif /* EMSCRIPTEN */
+
+#endif /* ROBOGEN_ISLAND_MIGRATION_H_ */
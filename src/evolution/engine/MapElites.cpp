@@ -0,0 +1,343 @@
+/*
+ * @(#) MapElites.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#ifndef EMSCRIPTEN
+
+#include "evolution/engine/MapElites.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "utils/network/ProtobufPacket.h"
+#include "Robogen.h"
+#include "Simulator.h"
+
+namespace robogen {
+
+/**
+ * Number of attempts at creating an offspring that differs from its parent
+ */
+#define MAX_OFFSPRING_ATTEMPTS 100
+
+MapElites::MapElites(boost::shared_ptr<EvolverConfiguration> conf,
+		boost::shared_ptr<EvolverLog> log, boost::random::mt19937 &rng) :
+		conf_(conf), log_(log), rng_(rng), numCells_(1),
+		qdScore_(0), issued_(0), evaluated_(0), checkpoints_(0) {
+
+	for (unsigned int i = 0; i < conf_->mapElitesDescriptors.size(); ++i) {
+		const std::string &name = conf_->mapElitesDescriptors[i].name;
+		unsigned int type = PARTS, objective = 0;
+		if (name == "limbs") {
+			type = LIMBS;
+		} else if (name == "motors") {
+			type = MOTORS;
+		} else if (name == "sensors") {
+			type = SENSORS;
+		} else if (name == "hidden") {
+			type = HIDDEN;
+		} else if (name.compare(0, 9, "objective") == 0) {
+			type = OBJECTIVE;
+			objective = std::atoi(name.c_str() + 9);
+		}
+		descriptors_.push_back(std::make_pair(type, objective));
+		numCells_ *= conf_->mapElitesDescriptors[i].bins;
+	}
+
+	budget_ = conf_->mu + (conf_->numGenerations - 1) * conf_->lambda;
+}
+
+MapElites::~MapElites() {
+}
+
+bool MapElites::resume(const std::string &journalFile) {
+
+	std::ifstream journal(journalFile.c_str(), std::ios::in | std::ios::binary);
+	if (!journal.is_open()) {
+		std::cerr << "Cannot open MAP-Elites archive " << journalFile
+				<< std::endl;
+		return false;
+	}
+
+	unsigned int entries = 0;
+	while (true) {
+		ProtobufPacket<robogenMessage::MapElitesElite> packet;
+		std::vector<unsigned char> headerBuffer(
+				ProtobufPacket<robogenMessage::MapElitesElite>::HEADER_SIZE);
+		if (!journal.read((char *) &headerBuffer[0], headerBuffer.size())) {
+			break;
+		}
+		std::vector<unsigned char> payloadBuffer(
+				packet.decodeHeader(headerBuffer));
+		if (payloadBuffer.empty() || !journal.read((char *) &payloadBuffer[0],
+				payloadBuffer.size()) || !packet.decodePayload(payloadBuffer)) {
+			// the previous run stopped while writing this entry
+			std::cout << "Ignoring truncated entry at the end of the "
+					<< "MAP-Elites archive" << std::endl;
+			break;
+		}
+
+		boost::shared_ptr<robogenMessage::MapElitesElite> elite =
+				packet.getMessage();
+		boost::shared_ptr<RobotRepresentation> robot(
+				new RobotRepresentation());
+		if (!robot->init(elite->robot())) {
+			std::cerr << "Invalid robot in the MAP-Elites archive"
+					<< std::endl;
+			return false;
+		}
+		std::vector<double> objectives(elite->objectives().begin(),
+				elite->objectives().end());
+		robot->setEvaluationResult(elite->fitness(), objectives,
+				SimulationProfile(), false);
+		insert(robot);
+		++entries;
+	}
+
+	std::cout << "Resumed " << archive_.size() << " elites from " << entries
+			<< " archive entries" << std::endl;
+	return true;
+}
+
+void MapElites::setInitialPopulation(
+		boost::shared_ptr<Population> population) {
+
+	for (unsigned int i = 0; i < population->size(); ++i) {
+		seeds_.push_back(population->at(i));
+		// a resumed archive replaces the initial individuals
+		if (archive_.empty()) {
+			initial_.push(population->at(i));
+		}
+	}
+}
+
+unsigned int MapElites::getBudget() const {
+	return budget_;
+}
+
+boost::shared_ptr<RobotRepresentation> MapElites::next() {
+
+	if (issued_ >= budget_) {
+		return boost::shared_ptr<RobotRepresentation>();
+	}
+	++issued_;
+
+	Breeder *breeder = breeders_.get();
+	if (breeder == NULL) {
+		breeder = new Breeder(conf_, rng_());
+		breeders_.reset(breeder);
+	}
+	breeder->parent.reset();
+
+	if (!initial_.empty()) {
+		boost::shared_ptr<RobotRepresentation> robot = initial_.front();
+		initial_.pop();
+		return robot;
+	}
+
+	// parent picked uniformly among the filled cells
+	boost::shared_ptr<RobotRepresentation> parent;
+	if (filled_.empty()) {
+		boost::random::uniform_int_distribution<unsigned int> dist(0,
+				seeds_.size() - 1);
+		parent = seeds_[dist(rng_)];
+	} else {
+		boost::random::uniform_int_distribution<unsigned int> dist(0,
+				filled_.size() - 1);
+		parent = archive_[filled_[dist(rng_)]];
+	}
+
+	// elites are never modified once archived, the parent can be read
+	// concurrently while the archive changes
+	breeder->parent = parent;
+	return parent;
+}
+
+boost::shared_ptr<RobotRepresentation> MapElites::prepare(
+		boost::shared_ptr<RobotRepresentation> robot) {
+
+	Breeder *breeder = breeders_.get();
+	if (breeder == NULL || !breeder->parent) {
+		return robot;
+	}
+	boost::shared_ptr<RobotRepresentation> parent = breeder->parent;
+	breeder->parent.reset();
+
+	boost::shared_ptr<RobotRepresentation> offspring;
+	for (unsigned int attempt = 0; attempt < MAX_OFFSPRING_ATTEMPTS;
+			++attempt) {
+		offspring = breeder->mutator.createOffspring(parent)[0];
+		// an unmodified copy would only be evaluated again
+		if (!offspring->isEvaluated()) {
+			break;
+		}
+	}
+	return offspring;
+}
+
+void MapElites::completed(boost::shared_ptr<RobotRepresentation> robot) {
+
+	insert(robot);
+
+	++evaluated_;
+	if (evaluated_ % conf_->lambda == 0) {
+		checkpoint();
+	}
+}
+
+void MapElites::finish() {
+
+	if (evaluated_ % conf_->lambda != 0) {
+		checkpoint();
+	}
+	log_->logElites(archive_);
+}
+
+bool MapElites::getDescriptor(boost::shared_ptr<RobotRepresentation> robot,
+		unsigned int axis, double &value) {
+
+	unsigned int type = descriptors_[axis].first;
+	if (type == OBJECTIVE) {
+		const std::vector<double> &objectives = robot->getObjectives();
+		if (descriptors_[axis].second >= objectives.size()) {
+			return false;
+		}
+		value = objectives[descriptors_[axis].second];
+		return true;
+	}
+
+	if (type == HIDDEN) {
+		value = robot->getBrain()->getNumHidden();
+		return true;
+	}
+
+	const RobotRepresentation::IdPartMap &body = robot->getBody();
+	if (type == PARTS) {
+		value = body.size();
+		return true;
+	}
+
+	if (type == LIMBS) {
+		RobotRepresentation::IdPartMap::const_iterator root = body.find(
+				robot->getBodyRootId());
+		boost::shared_ptr<PartRepresentation> core;
+		if (root != body.end()) {
+			core = root->second.lock();
+		}
+		value = core ? core->getChildrenCount() : 0;
+		return true;
+	}
+
+	value = 0;
+	for (RobotRepresentation::IdPartMap::const_iterator it = body.begin();
+			it != body.end(); ++it) {
+		boost::shared_ptr<PartRepresentation> part = it->second.lock();
+		if (!part) {
+			continue;
+		}
+		value += (type == MOTORS) ? part->getMotors().size() :
+				part->getSensors().size();
+	}
+	return true;
+}
+
+bool MapElites::getCell(boost::shared_ptr<RobotRepresentation> robot,
+		boost::uint64_t &cell) {
+
+	cell = 0;
+	for (unsigned int i = 0; i < descriptors_.size(); ++i) {
+		const EvolverConfiguration::MapElitesDescriptor &descriptor =
+				conf_->mapElitesDescriptors[i];
+		double value;
+		if (!getDescriptor(robot, i, value)) {
+			return false;
+		}
+
+		// values out of range go to the border bins
+		int bin = (int) std::floor((value - descriptor.min) /
+				(descriptor.max - descriptor.min) * descriptor.bins);
+		bin = std::max(0, std::min(bin, (int) descriptor.bins - 1));
+		cell = cell * descriptor.bins + bin;
+	}
+	return true;
+}
+
+bool MapElites::insert(boost::shared_ptr<RobotRepresentation> robot) {
+
+	// individuals whose simulation failed or violated constraints
+	double fitness = robot->getFitness();
+	if (!robot->isEvaluated() || fitness <= MIN_FITNESS) {
+		return false;
+	}
+
+	boost::uint64_t cell;
+	if (!getCell(robot, cell)) {
+		return false;
+	}
+
+	std::map<boost::uint64_t, boost::shared_ptr<RobotRepresentation> >::
+			iterator elite = archive_.find(cell);
+	if (elite == archive_.end()) {
+		archive_[cell] = robot;
+		filled_.push_back(cell);
+		qdScore_ += fitness;
+	} else if (fitness > elite->second->getFitness()) {
+		qdScore_ += fitness - elite->second->getFitness();
+		elite->second = robot;
+	} else {
+		return false;
+	}
+
+	if (!best_ || fitness > best_->getFitness()) {
+		best_ = robot;
+	}
+
+	if (!log_->logElite(robot)) {
+		exitRobogen(EXIT_FAILURE);
+	}
+	return true;
+}
+
+void MapElites::checkpoint() {
+
+	++checkpoints_;
+	if (!best_) {
+		std::cout << "Checkpoint " << checkpoints_ << ", Evaluations: "
+				<< evaluated_ << ", no elite yet" << std::endl;
+		return;
+	}
+	if (!log_->logArchive(checkpoints_, evaluated_, archive_.size(),
+			archive_.size() / numCells_, qdScore_, best_)) {
+		exitRobogen(EXIT_FAILURE);
+	}
+}
+
+} /* namespace robogen */
+
+#endif /* EMSCRIPTEN */
@@ -0,0 +1,240 @@
+/*
+ * @(#) MapElites.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_MAP_ELITES_H_
+#define ROBOGEN_MAP_ELITES_H_
+
+#ifndef EMSCRIPTEN
+
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/tss.hpp>
+#include "config/EvolverConfiguration.h"
+#include "evolution/engine/Evaluator.h"
+#include "evolution/engine/EvolverLog.h"
+#include "evolution/engine/Mutator.h"
+#include "evolution/engine/Population.h"
+
+namespace robogen {
+
+/**
+ * MAP-Elites quality diversity search: keeps the best individual (elite) of
+ * each cell of a grid spanned by morphology or behavior descriptors, and
+ * mutates elites picked uniformly among the filled cells.
+ *
+ * There are no generations: as an evaluation stream, offspring are created
+ * whenever an evaluator is idle, and inserted in the archive as soon as
+ * their evaluation completes. The run lasts as many evaluations as a
+ * generational run would (mu + (numGenerations - 1) * lambda), with a
+ * checkpoint every lambda evaluations. Parents are picked by next(), under
+ * the evaluator's lock, but mutated by prepare(), in parallel: each
+ * evaluation thread has its own mutator and random number generator.
+ *
+ * The archive is sparse (only filled cells are stored), and every new elite
+ * is appended to a journal, from which another run can be resumed.
+ */
+class MapElites : public EvaluationStream {
+public:
+	/**
+	 * @param conf evolver configuration, with the grid axes and the mutation
+	 * parameters
+	 * @param log log of the run, receives the journal and the checkpoints
+	 * @param rng random number generator, to pick parents and to seed the
+	 * mutators of the evaluation threads
+	 */
+	MapElites(boost::shared_ptr<EvolverConfiguration> conf,
+			boost::shared_ptr<EvolverLog> log, boost::random::mt19937 &rng);
+
+	virtual ~MapElites();
+
+	/**
+	 * Fills the archive with the elites of a previous run
+	 * @param journalFile archive journal of the previous run
+	 * @return true if the journal could be read
+	 */
+	bool resume(const std::string &journalFile);
+
+	/**
+	 * Sets the individuals evaluated first, while the archive is empty
+	 * @param population initial individuals, not evaluated
+	 */
+	void setInitialPopulation(boost::shared_ptr<Population> population);
+
+	/**
+	 * @return number of evaluations of the run
+	 */
+	unsigned int getBudget() const;
+
+	virtual boost::shared_ptr<RobotRepresentation> next();
+
+	/**
+	 * Creates the offspring of the parent picked by the last call to next()
+	 * on this thread
+	 */
+	virtual boost::shared_ptr<RobotRepresentation> prepare(
+			boost::shared_ptr<RobotRepresentation> robot);
+
+	virtual void completed(boost::shared_ptr<RobotRepresentation> robot);
+
+	/**
+	 * Logs the final state of the archive, once the stream is exhausted
+	 */
+	void finish();
+
+private:
+	/**
+	 * Offspring creation state of an evaluation thread
+	 */
+	struct Breeder {
+		Breeder(boost::shared_ptr<EvolverConfiguration> conf,
+				unsigned int seed) : rng(seed), mutator(conf, rng) {
+		}
+
+		boost::random::mt19937 rng;
+		Mutator mutator;
+
+		/**
+		 * Parent picked by the last call to next(), empty if it handed out
+		 * an initial individual
+		 */
+		boost::shared_ptr<RobotRepresentation> parent;
+	};
+
+	/**
+	 * Kinds of descriptors
+	 */
+	enum DescriptorTypes {
+		PARTS, LIMBS, MOTORS, SENSORS, HIDDEN, OBJECTIVE
+	};
+
+	/**
+	 * Computes the value of a descriptor
+	 * @param robot evaluated individual
+	 * @param axis index of the descriptor in the configuration
+	 * @param value set to the descriptor value
+	 * @return false if the descriptor is not available for this individual
+	 * (objective not returned by the scenario)
+	 */
+	bool getDescriptor(boost::shared_ptr<RobotRepresentation> robot,
+			unsigned int axis, double &value);
+
+	/**
+	 * Computes the cell of an individual, in row-major order
+	 * @return false if one of its descriptors is not available
+	 */
+	bool getCell(boost::shared_ptr<RobotRepresentation> robot,
+			boost::uint64_t &cell);
+
+	/**
+	 * Inserts an evaluated individual if its cell is empty or if it beats
+	 * the elite of its cell, recording it in the journal
+	 * @return true if it was inserted
+	 */
+	bool insert(boost::shared_ptr<RobotRepresentation> robot);
+
+	/**
+	 * Logs the state of the archive and flushes the journal
+	 */
+	void checkpoint();
+
+	boost::shared_ptr<EvolverConfiguration> conf_;
+	boost::shared_ptr<EvolverLog> log_;
+	boost::random::mt19937 &rng_;
+
+	/**
+	 * Breeder of each evaluation thread, created on its first call to next()
+	 */
+	boost::thread_specific_ptr<Breeder> breeders_;
+
+	/**
+	 * Type of each descriptor, and objective index for OBJECTIVE
+	 */
+	std::vector<std::pair<unsigned int, unsigned int> > descriptors_;
+
+	/**
+	 * Total number of cells of the grid
+	 */
+	double numCells_;
+
+	/**
+	 * Elites by cell
+	 */
+	std::map<boost::uint64_t, boost::shared_ptr<RobotRepresentation> >
+			archive_;
+
+	/**
+	 * Filled cells, in order of filling, to pick parents uniformly
+	 */
+	std::vector<boost::uint64_t> filled_;
+
+	/**
+	 * Best elite
+	 */
+	boost::shared_ptr<RobotRepresentation> best_;
+
+	/**
+	 * Sum of the fitness of the elites
+	 */
+	double qdScore_;
+
+	/**
+	 * Initial individuals not handed out yet
+	 */
+	std::queue<boost::shared_ptr<RobotRepresentation> > initial_;
+
+	/**
+	 * Initial individuals, mutated while no elite is archived yet
+	 */
+	std::vector<boost::shared_ptr<RobotRepresentation> > seeds_;
+
+	/**
+	 * Number of evaluations of the run
+	 */
+	unsigned int budget_;
+
+	/**
+	 * Number of individuals handed out and evaluated so far
+	 */
+	unsigned int issued_;
+	unsigned int evaluated_;
+
+	/**
+	 * Number of checkpoints so far
+	 */
+	unsigned int checkpoints_;
+};
+
+} /* namespace robogen */
+
+#endif /* EMSCRIPTEN */
+
+#endif /* ROBOGEN_MAP_ELITES_H_ */
@@ -0,0 +1,220 @@
+/*
+ * @(#) Surrogate.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#include "evolution/engine/Surrogate.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include "PartList.h"
+
+// regularization of the regression, relative to standardized features
+#define SURROGATE_RIDGE 1.0
+
+namespace robogen {
+
+Surrogate::Surrogate(unsigned int maxSamples) :
+		maxSamples_(maxSamples), trained_(false), intercept_(0) {
+}
+
+Surrogate::~Surrogate() {
+}
+
+std::vector<double> Surrogate::getFeatures(
+		boost::shared_ptr<RobotRepresentation> robot, double parentFitness) {
+
+	std::vector<double> features;
+
+	// body: parts per type, depth, motors, sensors
+	std::map<std::string, unsigned int> typeCounts;
+	unsigned int depth = 0, motors = 0, sensors = 0;
+	const RobotRepresentation::IdPartMap &body = robot->getBody();
+	for (RobotRepresentation::IdPartMap::const_iterator it = body.begin();
+			it != body.end(); ++it) {
+		boost::shared_ptr<PartRepresentation> part = it->second.lock();
+		if (!part) {
+			continue;
+		}
+		++typeCounts[part->getType()];
+		motors += part->getMotors().size();
+		sensors += part->getSensors().size();
+		unsigned int partDepth = 0;
+		for (PartRepresentation *p = part->getParent(); p != NULL;
+				p = p->getParent()) {
+			++partDepth;
+		}
+		depth = std::max(depth, partDepth);
+	}
+	for (std::map<std::string, char>::const_iterator it =
+			INVERSE_PART_TYPE_MAP.begin(); it != INVERSE_PART_TYPE_MAP.end();
+			++it) {
+		std::map<std::string, unsigned int>::const_iterator count =
+				typeCounts.find(it->first);
+		features.push_back(count == typeCounts.end() ? 0 : count->second);
+	}
+	features.push_back(body.size());
+	features.push_back(depth);
+	features.push_back(motors);
+	features.push_back(sensors);
+
+	// brain: size and weight statistics
+	std::vector<double*> weights;
+	std::vector<unsigned int> types;
+	std::vector<double*> params;
+	robot->getBrainGenome(weights, types, params);
+	double sum = 0, sumSquares = 0, sumAbs = 0;
+	for (unsigned int i = 0; i < weights.size(); ++i) {
+		sum += *weights[i];
+		sumSquares += (*weights[i]) * (*weights[i]);
+		sumAbs += std::fabs(*weights[i]);
+	}
+	double mean = 0, variance = 0, meanAbs = 0;
+	if (!weights.empty()) {
+		mean = sum / weights.size();
+		variance = std::max(0.0, sumSquares / weights.size() - mean * mean);
+		meanAbs = sumAbs / weights.size();
+	}
+	features.push_back(weights.size());
+	features.push_back(robot->getBrain()->getNumHidden());
+	features.push_back(mean);
+	features.push_back(std::sqrt(variance));
+	features.push_back(meanAbs);
+
+	features.push_back(parentFitness);
+
+	return features;
+}
+
+void Surrogate::addSample(const std::vector<double> &features,
+		double fitness) {
+	samples_.push_back(std::make_pair(features, fitness));
+	while (samples_.size() > maxSamples_) {
+		samples_.pop_front();
+	}
+}
+
+bool Surrogate::train() {
+
+	if (samples_.size() < 2) {
+		return false;
+	}
+
+	const unsigned int n = samples_.size();
+	const unsigned int d = samples_.front().first.size();
+
+	// standardize features, center fitness
+	means_.assign(d, 0);
+	scales_.assign(d, 0);
+	intercept_ = 0;
+	for (unsigned int s = 0; s < n; ++s) {
+		for (unsigned int j = 0; j < d; ++j) {
+			means_[j] += samples_[s].first[j];
+		}
+		intercept_ += samples_[s].second;
+	}
+	for (unsigned int j = 0; j < d; ++j) {
+		means_[j] /= n;
+	}
+	intercept_ /= n;
+	for (unsigned int s = 0; s < n; ++s) {
+		for (unsigned int j = 0; j < d; ++j) {
+			double diff = samples_[s].first[j] - means_[j];
+			scales_[j] += diff * diff;
+		}
+	}
+	for (unsigned int j = 0; j < d; ++j) {
+		scales_[j] = std::sqrt(scales_[j] / n);
+		if (scales_[j] < 1e-9) {
+			// constant feature, contributes nothing
+			scales_[j] = 1;
+		}
+	}
+
+	// normal equations (Z'Z + ridge * I) w = Z'y as an augmented matrix
+	std::vector<std::vector<double> > a(d, std::vector<double>(d + 1, 0));
+	std::vector<double> z(d);
+	for (unsigned int s = 0; s < n; ++s) {
+		for (unsigned int j = 0; j < d; ++j) {
+			z[j] = (samples_[s].first[j] - means_[j]) / scales_[j];
+		}
+		double y = samples_[s].second - intercept_;
+		for (unsigned int i = 0; i < d; ++i) {
+			for (unsigned int j = 0; j < d; ++j) {
+				a[i][j] += z[i] * z[j];
+			}
+			a[i][d] += z[i] * y;
+		}
+	}
+	for (unsigned int i = 0; i < d; ++i) {
+		a[i][i] += SURROGATE_RIDGE;
+	}
+
+	// Gauss-Jordan elimination, the matrix is symmetric positive definite
+	for (unsigned int col = 0; col < d; ++col) {
+		unsigned int pivot = col;
+		for (unsigned int row = col + 1; row < d; ++row) {
+			if (std::fabs(a[row][col]) > std::fabs(a[pivot][col])) {
+				pivot = row;
+			}
+		}
+		std::swap(a[col], a[pivot]);
+		for (unsigned int row = 0; row < d; ++row) {
+			if (row == col) {
+				continue;
+			}
+			double factor = a[row][col] / a[col][col];
+			for (unsigned int k = col; k <= d; ++k) {
+				a[row][k] -= factor * a[col][k];
+			}
+		}
+	}
+	weights_.resize(d);
+	for (unsigned int j = 0; j < d; ++j) {
+		weights_[j] = a[j][d] / a[j][j];
+	}
+
+	trained_ = true;
+	return true;
+}
+
+bool Surrogate::isTrained() const {
+	return trained_;
+}
+
+double Surrogate::predict(const std::vector<double> &features) const {
+	double prediction = intercept_;
+	for (unsigned int j = 0; j < weights_.size(); ++j) {
+		prediction += weights_[j] * (features[j] - means_[j]) / scales_[j];
+	}
+	return prediction;
+}
+
+unsigned int Surrogate::getNumSamples() const {
+	return samples_.size();
+}
+
+} /* namespace robogen */
@@ -0,0 +1,130 @@
+/*
+ * @(#) Surrogate.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_SURROGATE_H_
+#define ROBOGEN_SURROGATE_H_
+
+#include <deque>
+#include <utility>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "evolution/representation/RobotRepresentation.h"
+
+namespace robogen {
+
+/**
+ * Online regression model predicting the fitness of an individual from cheap
+ * genotype features, used to pre-screen offspring before simulating them.
+ *
+ * The model is a ridge regression over standardized features, refitted from
+ * the most recent real evaluations whenever train() is called.
+ */
+class Surrogate {
+
+public:
+
+	/**
+	 * @param maxSamples number of most recent evaluations kept for training
+	 */
+	Surrogate(unsigned int maxSamples);
+
+	virtual ~Surrogate();
+
+	/**
+	 * Compute the features of an individual: part counts per type, body
+	 * depth, motor and sensor counts, brain weight statistics and the fitness
+	 * of its parents
+	 * @param robot the individual
+	 * @param parentFitness mean fitness of the parents of the individual
+	 */
+	static std::vector<double> getFeatures(
+			boost::shared_ptr<RobotRepresentation> robot, double parentFitness);
+
+	/**
+	 * Record a real evaluation, dropping the oldest one if maxSamples are
+	 * already kept
+	 */
+	void addSample(const std::vector<double> &features, double fitness);
+
+	/**
+	 * Refit the model to the recorded evaluations
+	 * @return false if there are not enough evaluations to fit it yet
+	 */
+	bool train();
+
+	/**
+	 * @return true once the model could be fitted
+	 */
+	bool isTrained() const;
+
+	/**
+	 * @return the predicted fitness, only meaningful if isTrained()
+	 */
+	double predict(const std::vector<double> &features) const;
+
+	/**
+	 * @return number of evaluations recorded
+	 */
+	unsigned int getNumSamples() const;
+
+private:
+
+	/**
+	 * Number of most recent evaluations kept
+	 */
+	unsigned int maxSamples_;
+
+	/**
+	 * Recorded (features, fitness) pairs, oldest first
+	 */
+	std::deque<std::pair<std::vector<double>, double> > samples_;
+
+	/**
+	 * Whether the model has been fitted
+	 */
+	bool trained_;
+
+	/**
+	 * Feature means and standard deviations used for standardization
+	 */
+	std::vector<double> means_;
+	std::vector<double> scales_;
+
+	/**
+	 * Regression coefficients over standardized features
+	 */
+	std::vector<double> weights_;
+
+	/**
+	 * Mean fitness of the training set (intercept)
+	 */
+	double intercept_;
+
+};
+
+} /* namespace robogen */
+#endif /* ROBOGEN_SURROGATE_H_ */
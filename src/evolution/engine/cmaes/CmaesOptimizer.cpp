@@ -0,0 +1,470 @@
+/*
+ * @(#) CmaesOptimizer.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include "evolution/engine/cmaes/CmaesOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <boost/random/uniform_01.hpp>
+#include "evolution/representation/NeuronRepresentation.h"
+
+// restart if the step size falls below this, in units of the gene ranges
+#define CMAES_TOL_X 1e-12
+// restart if the best fitness varies less than this over the history
+#define CMAES_TOL_FUN 1e-12
+// restart if the condition number of the covariance matrix exceeds this
+#define CMAES_MAX_CONDITION 1e14
+
+namespace robogen {
+
+namespace {
+
+/**
+ * Eigendecomposition of a symmetric matrix by cyclic Jacobi rotations
+ * @param a symmetric matrix
+ * @param vectors filled with the eigenvectors, as columns
+ * @param values filled with the eigenvalues
+ */
+void symmetricEigen(const std::vector<std::vector<double> > &a,
+		std::vector<std::vector<double> > &vectors,
+		std::vector<double> &values) {
+
+	const unsigned int n = a.size();
+	std::vector<std::vector<double> > m = a;
+	vectors.assign(n, std::vector<double>(n, 0));
+	for (unsigned int i = 0; i < n; ++i) {
+		vectors[i][i] = 1;
+	}
+
+	double total = 0;
+	for (unsigned int i = 0; i < n; ++i) {
+		for (unsigned int j = 0; j < n; ++j) {
+			total += m[i][j] * m[i][j];
+		}
+	}
+
+	for (unsigned int sweep = 0; sweep < 50; ++sweep) {
+		double off = 0;
+		for (unsigned int p = 0; p < n; ++p) {
+			for (unsigned int q = p + 1; q < n; ++q) {
+				off += m[p][q] * m[p][q];
+			}
+		}
+		if (off <= 1e-24 * total) {
+			break;
+		}
+
+		for (unsigned int p = 0; p < n; ++p) {
+			for (unsigned int q = p + 1; q < n; ++q) {
+				if (m[p][q] == 0) {
+					continue;
+				}
+				double theta = (m[q][q] - m[p][p]) / (2 * m[p][q]);
+				double t = ((theta >= 0) ? 1 : -1) /
+						(std::fabs(theta) + std::sqrt(theta * theta + 1));
+				double c = 1 / std::sqrt(t * t + 1);
+				double s = t * c;
+				for (unsigned int k = 0; k < n; ++k) {
+					double kp = m[k][p], kq = m[k][q];
+					m[k][p] = c * kp - s * kq;
+					m[k][q] = s * kp + c * kq;
+				}
+				for (unsigned int k = 0; k < n; ++k) {
+					double pk = m[p][k], qk = m[q][k];
+					m[p][k] = c * pk - s * qk;
+					m[q][k] = s * pk + c * qk;
+				}
+				for (unsigned int k = 0; k < n; ++k) {
+					double kp = vectors[k][p], kq = vectors[k][q];
+					vectors[k][p] = c * kp - s * kq;
+					vectors[k][q] = s * kp + c * kq;
+				}
+			}
+		}
+	}
+
+	values.resize(n);
+	for (unsigned int i = 0; i < n; ++i) {
+		values[i] = m[i][i];
+	}
+}
+
+/**
+ * Mirrors a value into [0, 1] at the bounds. Samples are repaired this way
+ * before the update sees them: with clipping only, the mean can drift out of
+ * the bounds, where fitness no longer depends on it.
+ */
+double reflect(double x) {
+	x = std::fabs(x);
+	x = std::fmod(x, 2.);
+	return (x > 1) ? 2 - x : x;
+}
+
+}
+
+CmaesOptimizer::CmaesOptimizer(boost::shared_ptr<EvolverConfiguration> conf,
+		boost::random::mt19937 &rng) : conf_(conf), rng_(rng),
+		normalDistribution_(0, 1), n_(0), lambda_(conf->lambda),
+		mu_(conf->mu), muEff_(0), cc_(0), cs_(0), c1_(0), cmu_(0),
+		damps_(0), chiN_(0), sigma_(0), generation_(0),
+		evaluationsSinceEigen_(0), restarts_(0) {
+}
+
+CmaesOptimizer::~CmaesOptimizer() {
+}
+
+bool CmaesOptimizer::fillPopulationWeights(
+		boost::shared_ptr<Population> &population) {
+
+	boost::shared_ptr<RobotRepresentation> seed = population->at(0);
+
+	std::vector<double*> weights;
+	std::vector<double*> params;
+	std::vector<unsigned int> types;
+	seed->getBrainGenome(weights, types, params);
+
+	// bounds of every gene, in the order of the genome
+	lowerBounds_.assign(weights.size(), conf_->minBrainWeight);
+	ranges_.assign(weights.size(),
+			conf_->maxBrainWeight - conf_->minBrainWeight);
+	for (unsigned int i = 0; i < types.size(); ++i) {
+		if (types[i] == NeuronRepresentation::SIGMOID) {
+			lowerBounds_.push_back(conf_->minBrainBias);
+			ranges_.push_back(conf_->maxBrainBias - conf_->minBrainBias);
+		} else if (types[i] == NeuronRepresentation::CTRNN_SIGMOID) {
+			lowerBounds_.push_back(conf_->minBrainBias);
+			ranges_.push_back(conf_->maxBrainBias - conf_->minBrainBias);
+			lowerBounds_.push_back(conf_->minBrainTau);
+			ranges_.push_back(conf_->maxBrainTau - conf_->minBrainTau);
+		} else if (types[i] == NeuronRepresentation::OSCILLATOR) {
+			lowerBounds_.push_back(conf_->minBrainPeriod);
+			ranges_.push_back(conf_->maxBrainPeriod - conf_->minBrainPeriod);
+			lowerBounds_.push_back(conf_->minBrainPhaseOffset);
+			ranges_.push_back(conf_->maxBrainPhaseOffset -
+					conf_->minBrainPhaseOffset);
+			lowerBounds_.push_back(conf_->minBrainAmplitude);
+			ranges_.push_back(conf_->maxBrainAmplitude -
+					conf_->minBrainAmplitude);
+		} else {
+			std::cerr << "CMA-ES cannot handle neuron type " << types[i]
+					<< std::endl;
+			return false;
+		}
+	}
+	if (lowerBounds_.size() != weights.size() + params.size()) {
+		std::cerr << "CMA-ES: unexpected brain genome layout" << std::endl;
+		return false;
+	}
+
+	n_ = lowerBounds_.size();
+	if (n_ == 0) {
+		std::cerr << "CMA-ES: the brain has no parameter to optimize"
+				<< std::endl;
+		return false;
+	}
+	std::cout << "CMA-ES on " << n_ << " brain parameters" << std::endl;
+
+	// start from the brain of the first individual
+	std::vector<double> mean(n_);
+	for (unsigned int i = 0; i < n_; ++i) {
+		double value = (i < weights.size()) ? *weights[i] :
+				*params[i - weights.size()];
+		mean[i] = (ranges_[i] > 0) ?
+				std::min(1., std::max(0., (value - lowerBounds_[i]) /
+						ranges_[i])) : 0;
+	}
+
+	// all samples share the body and brain topology of the first individual
+	robots_.clear();
+	robots_.push_back(seed);
+	while (robots_.size() < lambda_) {
+		robots_.push_back(boost::shared_ptr<RobotRepresentation>(
+				new RobotRepresentation(*seed)));
+	}
+	population->clear();
+	population->insert(population->end(), robots_.begin(), robots_.end());
+
+	reset(mean);
+	sample(population);
+	return true;
+}
+
+bool CmaesOptimizer::produceNextGeneration(
+		boost::shared_ptr<Population> &population) {
+
+	// samples that kept a low fidelity fitness rank after all the fully
+	// evaluated ones
+	std::vector<std::pair<std::pair<bool, double>, unsigned int> > ranking;
+	for (unsigned int i = 0; i < robots_.size(); ++i) {
+		if (!robots_[i]->isEvaluated()) {
+			std::cout << "Population contains non-evaluated individuals, "
+					<< "cannot update CMA-ES" << std::endl;
+			return false;
+		}
+		ranking.push_back(std::make_pair(std::make_pair(
+				robots_[i]->isLowFidelity(), -robots_[i]->getFitness()), i));
+	}
+	std::sort(ranking.begin(), ranking.end());
+
+	bestHistory_.push_back(-ranking[0].first.second);
+	unsigned int historyLength = 10 + (unsigned int) std::ceil(30. * n_ /
+			lambda_);
+	while (bestHistory_.size() > historyLength) {
+		bestHistory_.pop_front();
+	}
+
+	// recombination
+	std::vector<double> oldMean = mean_;
+	std::fill(mean_.begin(), mean_.end(), 0);
+	for (unsigned int i = 0; i < mu_; ++i) {
+		const std::vector<double> &x = samples_[ranking[i].second];
+		for (unsigned int j = 0; j < n_; ++j) {
+			mean_[j] += weights_[i] * x[j];
+		}
+	}
+	std::vector<double> meanStep(n_);
+	for (unsigned int j = 0; j < n_; ++j) {
+		meanStep[j] = (mean_[j] - oldMean[j]) / sigma_;
+	}
+
+	// evolution paths
+	++generation_;
+	double psNorm = 0;
+	for (unsigned int i = 0; i < n_; ++i) {
+		double whitened = 0;
+		for (unsigned int j = 0; j < n_; ++j) {
+			whitened += invSqrtC_[i][j] * meanStep[j];
+		}
+		ps_[i] = (1 - cs_) * ps_[i] +
+				std::sqrt(cs_ * (2 - cs_) * muEff_) * whitened;
+		psNorm += ps_[i] * ps_[i];
+	}
+	psNorm = std::sqrt(psNorm);
+	bool hsig = psNorm / std::sqrt(1 - std::pow(1 - cs_, 2. * generation_))
+			/ chiN_ < 1.4 + 2. / (n_ + 1);
+	for (unsigned int i = 0; i < n_; ++i) {
+		pc_[i] = (1 - cc_) * pc_[i] + (hsig ?
+				std::sqrt(cc_ * (2 - cc_) * muEff_) * meanStep[i] : 0);
+	}
+
+	// covariance matrix: rank-one and rank-mu updates
+	double decay = 1 - c1_ - cmu_ + (hsig ? 0 : c1_ * cc_ * (2 - cc_));
+	std::vector<std::vector<double> > steps(mu_, std::vector<double>(n_));
+	for (unsigned int k = 0; k < mu_; ++k) {
+		const std::vector<double> &x = samples_[ranking[k].second];
+		for (unsigned int j = 0; j < n_; ++j) {
+			steps[k][j] = (x[j] - oldMean[j]) / sigma_;
+		}
+	}
+	for (unsigned int i = 0; i < n_; ++i) {
+		for (unsigned int j = 0; j <= i; ++j) {
+			double rankMu = 0;
+			for (unsigned int k = 0; k < mu_; ++k) {
+				rankMu += weights_[k] * steps[k][i] * steps[k][j];
+			}
+			C_[i][j] = decay * C_[i][j] + c1_ * pc_[i] * pc_[j] +
+					cmu_ * rankMu;
+			C_[j][i] = C_[i][j];
+		}
+	}
+
+	// step size
+	sigma_ *= std::exp((cs_ / damps_) * (psNorm / chiN_ - 1));
+
+	// the decomposition is only needed every few generations, O(n^2) per
+	// sample in between
+	evaluationsSinceEigen_ += lambda_;
+	if (evaluationsSinceEigen_ > lambda_ / (c1_ + cmu_) / n_ / 10) {
+		updateEigensystem();
+		evaluationsSinceEigen_ = 0;
+	}
+
+	std::cout << "CMA-ES generation " << generation_ << ", step size "
+			<< sigma_ << std::endl;
+
+	if (shouldRestart()) {
+		if (restarts_ < conf_->cmaesMaxRestarts) {
+			++restarts_;
+			lambda_ *= 2;
+			mu_ *= 2;
+			while (robots_.size() < lambda_) {
+				robots_.push_back(boost::shared_ptr<RobotRepresentation>(
+						new RobotRepresentation(*robots_[0])));
+				population->push_back(robots_.back());
+			}
+			boost::random::uniform_01<double> uniform;
+			std::vector<double> mean(n_);
+			for (unsigned int i = 0; i < n_; ++i) {
+				mean[i] = uniform(rng_);
+			}
+			std::cout << "CMA-ES restart " << restarts_ << " with "
+					<< lambda_ << " samples" << std::endl;
+			reset(mean);
+		}
+	}
+
+	sample(population);
+	return true;
+}
+
+void CmaesOptimizer::reset(const std::vector<double> &mean) {
+
+	// recombination weights
+	weights_.resize(mu_);
+	double sum = 0;
+	for (unsigned int i = 0; i < mu_; ++i) {
+		weights_[i] = std::log(mu_ + 0.5) - std::log(i + 1.);
+		sum += weights_[i];
+	}
+	double sumSquares = 0;
+	for (unsigned int i = 0; i < mu_; ++i) {
+		weights_[i] /= sum;
+		sumSquares += weights_[i] * weights_[i];
+	}
+	muEff_ = 1 / sumSquares;
+
+	// adaptation rates
+	const double n = n_;
+	cc_ = (4 + muEff_ / n) / (n + 4 + 2 * muEff_ / n);
+	cs_ = (muEff_ + 2) / (n + muEff_ + 5);
+	c1_ = 2 / ((n + 1.3) * (n + 1.3) + muEff_);
+	cmu_ = std::min(1 - c1_, 2 * (muEff_ - 2 + 1 / muEff_) /
+			((n + 2) * (n + 2) + muEff_));
+	damps_ = 1 + 2 * std::max(0., std::sqrt((muEff_ - 1) / (n + 1)) - 1) +
+			cs_;
+	chiN_ = std::sqrt(n) * (1 - 1 / (4 * n) + 1 / (21 * n * n));
+
+	// distribution
+	mean_ = mean;
+	sigma_ = conf_->cmaesSigma;
+	pc_.assign(n_, 0);
+	ps_.assign(n_, 0);
+	C_.assign(n_, std::vector<double>(n_, 0));
+	for (unsigned int i = 0; i < n_; ++i) {
+		C_[i][i] = 1;
+	}
+	B_ = C_;
+	invSqrtC_ = C_;
+	D_.assign(n_, 1);
+	generation_ = 0;
+	evaluationsSinceEigen_ = 0;
+	bestHistory_.clear();
+}
+
+void CmaesOptimizer::sample(boost::shared_ptr<Population> &population) {
+
+	samples_.resize(lambda_);
+	std::vector<double> z(n_);
+	for (unsigned int k = 0; k < lambda_; ++k) {
+		for (unsigned int j = 0; j < n_; ++j) {
+			z[j] = D_[j] * normalDistribution_(rng_);
+		}
+		samples_[k].resize(n_);
+		for (unsigned int i = 0; i < n_; ++i) {
+			double y = 0;
+			for (unsigned int j = 0; j < n_; ++j) {
+				y += B_[i][j] * z[j];
+			}
+			samples_[k][i] = reflect(mean_[i] + sigma_ * y);
+		}
+		writeGenome(samples_[k], robots_[k]);
+		robots_[k]->setDirty();
+	}
+}
+
+void CmaesOptimizer::writeGenome(const std::vector<double> &x,
+		boost::shared_ptr<RobotRepresentation> &robot) {
+
+	std::vector<double*> weights;
+	std::vector<double*> params;
+	std::vector<unsigned int> types;
+	robot->getBrainGenome(weights, types, params);
+
+	for (unsigned int i = 0; i < n_; ++i) {
+		double value = lowerBounds_[i] +
+				std::min(1., std::max(0., x[i])) * ranges_[i];
+		if (i < weights.size()) {
+			*weights[i] = value;
+		} else {
+			*params[i - weights.size()] = value;
+		}
+	}
+}
+
+void CmaesOptimizer::updateEigensystem() {
+
+	std::vector<double> eigenvalues;
+	symmetricEigen(C_, B_, eigenvalues);
+	for (unsigned int i = 0; i < n_; ++i) {
+		D_[i] = std::sqrt(std::max(eigenvalues[i], 1e-300));
+	}
+	for (unsigned int i = 0; i < n_; ++i) {
+		for (unsigned int j = 0; j < n_; ++j) {
+			double value = 0;
+			for (unsigned int k = 0; k < n_; ++k) {
+				value += B_[i][k] * B_[j][k] / D_[k];
+			}
+			invSqrtC_[i][j] = value;
+		}
+	}
+}
+
+bool CmaesOptimizer::shouldRestart() const {
+
+	// step size vanished in every direction
+	double maxStd = 0;
+	for (unsigned int i = 0; i < n_; ++i) {
+		maxStd = std::max(maxStd, std::sqrt(C_[i][i]));
+	}
+	if (sigma_ * maxStd < CMAES_TOL_X) {
+		return true;
+	}
+
+	// covariance matrix degenerated
+	double maxD = *std::max_element(D_.begin(), D_.end());
+	double minD = *std::min_element(D_.begin(), D_.end());
+	if (maxD * maxD > CMAES_MAX_CONDITION * minD * minD) {
+		return true;
+	}
+
+	// no progress over the history
+	unsigned int historyLength = 10 + (unsigned int) std::ceil(30. * n_ /
+			lambda_);
+	if (bestHistory_.size() >= historyLength) {
+		double best = *std::max_element(bestHistory_.begin(),
+				bestHistory_.end());
+		double worst = *std::min_element(bestHistory_.begin(),
+				bestHistory_.end());
+		if (best - worst < CMAES_TOL_FUN) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} /* namespace robogen */
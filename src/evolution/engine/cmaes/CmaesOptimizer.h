@@ -0,0 +1,178 @@
+/*
+ * @(#) CmaesOptimizer.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_CMAES_OPTIMIZER_H_
+#define ROBOGEN_CMAES_OPTIMIZER_H_
+
+#include <deque>
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/normal_distribution.hpp>
+#include "config/EvolverConfiguration.h"
+#include "evolution/engine/Population.h"
+
+namespace robogen {
+
+/**
+ * CMA-ES over the brain genome of a fixed body, as provided by
+ * NeuralNetworkRepresentation::getGenome (weights, then neuron params).
+ *
+ * Every gene is searched in [0, 1], mapped linearly onto its configured
+ * bounds; samples falling outside are mirrored back at the bounds. The
+ * population holds the lambda samples of the current generation; once they
+ * are evaluated, produceNextGeneration() updates the search distribution
+ * and writes the next samples into the same individuals.
+ *
+ * When the search stalls (step size or fitness progress vanishing, or the
+ * covariance matrix degenerating) it restarts from a random mean with twice
+ * as many samples (IPOP-CMA-ES), at most cmaesMaxRestarts times.
+ */
+class CmaesOptimizer {
+
+public:
+
+	/**
+	 * @param conf evolver configuration
+	 * @param rng random number generator
+	 */
+	CmaesOptimizer(boost::shared_ptr<EvolverConfiguration> conf,
+			boost::random::mt19937 &rng);
+
+	virtual ~CmaesOptimizer();
+
+	/**
+	 * Starts the search from the brain of the first individual of the
+	 * population, and replaces the population with the first samples
+	 * @return false if the population cannot be searched by CMA-ES
+	 */
+	bool fillPopulationWeights(boost::shared_ptr<Population> &population);
+
+	/**
+	 * Updates the search distribution from the evaluated samples, then
+	 * replaces them with new ones
+	 * @return false if the population was not evaluated
+	 */
+	bool produceNextGeneration(boost::shared_ptr<Population> &population);
+
+private:
+
+	/**
+	 * Sets the strategy parameters for the current lambda and resets the
+	 * distribution around the given mean
+	 */
+	void reset(const std::vector<double> &mean);
+
+	/**
+	 * Draws a new sample for every individual and writes it in its brain
+	 */
+	void sample(boost::shared_ptr<Population> &population);
+
+	/**
+	 * Writes a point of the search space into the brain of an individual
+	 */
+	void writeGenome(const std::vector<double> &x,
+			boost::shared_ptr<RobotRepresentation> &robot);
+
+	/**
+	 * Recomputes B, D and C^-1/2 from the covariance matrix
+	 */
+	void updateEigensystem();
+
+	/**
+	 * @return true if the search has stalled and should restart
+	 */
+	bool shouldRestart() const;
+
+	boost::shared_ptr<EvolverConfiguration> conf_;
+	boost::random::mt19937 &rng_;
+	boost::random::normal_distribution<double> normalDistribution_;
+
+	/**
+	 * Lower bound and range of every gene
+	 */
+	std::vector<double> lowerBounds_;
+	std::vector<double> ranges_;
+
+	/**
+	 * Dimension, number of samples and of recombined samples
+	 */
+	unsigned int n_;
+	unsigned int lambda_;
+	unsigned int mu_;
+
+	/**
+	 * Strategy parameters
+	 */
+	std::vector<double> weights_;
+	double muEff_;
+	double cc_;
+	double cs_;
+	double c1_;
+	double cmu_;
+	double damps_;
+	double chiN_;
+
+	/**
+	 * Distribution state: mean, step size, evolution paths, covariance
+	 * matrix C = B diag(D^2) B^T and C^-1/2
+	 */
+	std::vector<double> mean_;
+	double sigma_;
+	std::vector<double> pc_;
+	std::vector<double> ps_;
+	std::vector<std::vector<double> > C_;
+	std::vector<std::vector<double> > B_;
+	std::vector<double> D_;
+	std::vector<std::vector<double> > invSqrtC_;
+
+	/**
+	 * Generations since the last restart, and evaluations since the last
+	 * eigendecomposition
+	 */
+	unsigned int generation_;
+	unsigned int evaluationsSinceEigen_;
+
+	/**
+	 * Best fitness of the most recent generations, to detect stagnation
+	 */
+	std::deque<double> bestHistory_;
+
+	/**
+	 * Number of restarts done
+	 */
+	unsigned int restarts_;
+
+	/**
+	 * Current samples, in the order of robots_
+	 */
+	std::vector<std::vector<double> > samples_;
+	std::vector<boost::shared_ptr<RobotRepresentation> > robots_;
+
+};
+
+} /* namespace robogen */
+#endif /* ROBOGEN_CMAES_OPTIMIZER_H_ */
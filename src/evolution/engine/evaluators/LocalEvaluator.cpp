@@ -0,0 +1,176 @@
+/*
+ * @(#) LocalEvaluator.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#ifndef EMSCRIPTEN
+
+#include "evolution/engine/evaluators/LocalEvaluator.h"
+#include <iostream>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include "config/ConfigurationReader.h"
+#include "scenario/ScenarioFactory.h"
+#include "Simulator.h"
+
+namespace robogen {
+
+LocalEvaluator::LocalEvaluator(unsigned int nThreads, unsigned int seed) :
+		nThreads_(nThreads), seed_(seed), evaluations_(0) {
+	// keep ODE initialized between simulations
+	dInitODE2(0);
+}
+
+LocalEvaluator::~LocalEvaluator() {
+	dCloseODE();
+}
+
+/**
+ * Thread function simulating individuals until the stream is exhausted
+ * @param stream source of the Individuals to be evaluated
+ * @param streamMutex mutex for access to stream and evaluations
+ * @param seed base seed of the simulations
+ * @param evaluations number of evaluations handed over so far, numbers the
+ * 		seed of each individual
+ * @param requestTemplate evaluation request without the robot, each
+ * 		evaluation builds its own RobogenConfig from it, as a simulator
+ * 		server would, since scenarios are free to modify theirs
+ */
+void localEvaluationThread(EvaluationStream& stream,
+		boost::mutex& streamMutex, unsigned int seed,
+		unsigned int& evaluations,
+		const robogenMessage::EvaluationRequest& requestTemplate) {
+
+	robogenMessage::EvaluationRequest request = requestTemplate;
+	const bool lowFidelity = (request.has_simulationtime() ||
+			request.has_startpositions());
+
+	while (true) {
+
+		boost::mutex::scoped_lock lock(streamMutex);
+		boost::shared_ptr<RobotRepresentation> current = stream.next();
+		if (!current) {
+			return;
+		}
+		unsigned int currentSeed = seed + evaluations++;
+		std::cout << "." << std::flush;
+		lock.unlock();
+
+		current = stream.prepare(current);
+
+		double fitness = MIN_FITNESS;
+		std::vector<double> objectives;
+		SimulationProfile profile;
+
+		*request.mutable_robot() = current->serialize();
+		boost::shared_ptr<RobogenConfig> configuration =
+				ConfigurationReader::parseEvaluationRequest(request);
+		boost::shared_ptr<Scenario> scenario;
+		if (configuration != NULL) {
+			scenario = ScenarioFactory::createScenario(configuration);
+		}
+		if (scenario == NULL) {
+			std::cerr << "Could not set up the simulation, the individual "
+					<< "gets the minimum fitness" << std::endl;
+		} else {
+			boost::random::mt19937 rng;
+			rng.seed(currentSeed);
+
+			unsigned int simulationResult = runSimulations(scenario,
+					configuration, request.robot(), NULL, rng,
+					false, boost::shared_ptr<FileViewerLog>(), profile);
+
+			if (simulationResult == SIMULATION_FAILURE) {
+				std::cerr << "Simulation failed, the individual gets the "
+						<< "minimum fitness" << std::endl;
+			} else if (simulationResult == SIMULATION_SUCCESS) {
+				fitness = scenario->getFitness();
+				objectives = scenario->getObjectives();
+			}
+		}
+
+		current->setEvaluationResult(fitness, objectives, profile,
+				lowFidelity);
+
+		lock.lock();
+		stream.completed(current);
+
+	}
+
+}
+
+void LocalEvaluator::evaluate(
+		const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+		boost::shared_ptr<RobogenConfig> robotConf) {
+
+	BatchStream stream(robots);
+	evaluate(stream, robotConf);
+}
+
+void LocalEvaluator::evaluate(EvaluationStream &stream,
+		boost::shared_ptr<RobogenConfig> robotConf) {
+
+	// 1. Serialize access to the stream
+	boost::mutex streamMutex;
+
+	robogenMessage::EvaluationRequest request;
+	robogenMessage::SimulatorConf *confMessage =
+			request.mutable_configuration();
+	*confMessage = robotConf->serialize();
+	if (nThreads_ > 1 && confMessage->odethreads() > 1) {
+		// the ODE thread pool steps one world at a time
+		std::cout << "Individuals are simulated in parallel, ignoring "
+				<< "odeThreads" << std::endl;
+		confMessage->set_odethreads(1);
+	}
+	if (simulationTime_ > 0) {
+		request.set_simulationtime(simulationTime_);
+	}
+	if (startPositions_ > 0) {
+		request.set_startpositions(startPositions_);
+	}
+
+	// 2. Prepare thread structure
+	boost::thread_group evaluators;
+
+	// 3. Launch threads
+	for (unsigned int i = 0; i < nThreads_; i++) {
+		evaluators.add_thread(
+				new boost::thread(localEvaluationThread, boost::ref(stream),
+						boost::ref(streamMutex), seed_, boost::ref(evaluations_),
+						boost::cref(request)));
+	}
+
+	// 4. Join threads. The stream is now exhausted.
+	evaluators.join_all();
+
+	// newline after per-individual dots
+	std::cout << std::endl;
+}
+
+} /* namespace robogen */
+
+#endif /* EMSCRIPTEN */
@@ -0,0 +1,89 @@
+/*
+ * @(#) LocalEvaluator.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_LOCAL_EVALUATOR_H_
+#define ROBOGEN_LOCAL_EVALUATOR_H_
+
+#ifndef EMSCRIPTEN
+
+#include "evolution/engine/Evaluator.h"
+
+namespace robogen {
+
+/**
+ * Simulates individuals inside the evolver process, on a group of worker
+ * threads, without going through simulator servers.
+ *
+ * Each worker runs its own ODE world (the simulator globals are thread
+ * local), so running more than one worker requires ODE to be built with
+ * --enable-ou. The random generator quickstep uses to reorder constraints
+ * is process-wide however, so with quickstep and more than one worker
+ * results depend on thread scheduling.
+ */
+class LocalEvaluator : public Evaluator {
+public:
+	/**
+	 * @param nThreads number of worker threads
+	 * @param seed base seed of the simulation random number generators.
+	 * 		Evaluations are numbered in the order individuals are pulled from
+	 * 		their stream and each is seeded with seed + its number, so with
+	 * 		the exact solver results do not depend on which worker runs which
+	 * 		individual
+	 */
+	LocalEvaluator(unsigned int nThreads, unsigned int seed);
+
+	virtual void evaluate(
+			const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+			boost::shared_ptr<RobogenConfig> robotConf);
+
+	virtual void evaluate(EvaluationStream &stream,
+			boost::shared_ptr<RobogenConfig> robotConf);
+
+	virtual ~LocalEvaluator();
+
+private:
+	/**
+	 * Number of worker threads
+	 */
+	unsigned int nThreads_;
+
+	/**
+	 * Base seed of the simulations
+	 */
+	unsigned int seed_;
+
+	/**
+	 * Number of evaluations handed over so far
+	 */
+	unsigned int evaluations_;
+};
+
+} /* namespace robogen */
+
+#endif /* EMSCRIPTEN */
+
+#endif /* ROBOGEN_LOCAL_EVALUATOR_H_ */
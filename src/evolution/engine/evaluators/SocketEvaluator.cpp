@@ -0,0 +1,158 @@
+/*
+ * @(#) SocketEvaluator.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#include "evolution/engine/evaluators/SocketEvaluator.h"
+#include <iostream>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#ifdef EMSCRIPTEN
+#include <utils/network/FakeJSSocket.h>
+#include <boost/lexical_cast.hpp>
+void sendJSEvent(std::string name, std::string jsonData);
+#endif
+
+namespace robogen {
+
+SocketEvaluator::SocketEvaluator(std::vector<Socket*> &sockets) :
+		sockets_(sockets) {
+}
+
+SocketEvaluator::~SocketEvaluator() {
+}
+
+/**
+ * Thread function assigned to a socket
+ * @param stream source of the Individuals to be evaluated
+ * @param streamMutex mutex for access to stream
+ * @param socket socket to simulator
+ * @param confFile simulator configuration file to be used for evaluations
+ * @param simulationTime simulation time override, 0 if none
+ * @param startPositions start positions override, 0 if none
+ */
+void evaluationThread(EvaluationStream& stream,
+		boost::mutex& streamMutex, Socket& socket,
+		boost::shared_ptr<RobogenConfig> robotConf, float simulationTime,
+		unsigned int startPositions) {
+
+	while (true) {
+
+		boost::mutex::scoped_lock lock(streamMutex);
+		boost::shared_ptr<RobotRepresentation> current = stream.next();
+		if (!current) {
+			return;
+		}
+		std::cout << "." << std::flush;
+		lock.unlock();
+
+		current = stream.prepare(current);
+
+		current->evaluate(&socket, robotConf, simulationTime, startPositions);
+
+		lock.lock();
+		stream.completed(current);
+
+	}
+
+}
+
+void SocketEvaluator::evaluate(
+		const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+		boost::shared_ptr<RobogenConfig> robotConf) {
+
+#ifdef EMSCRIPTEN
+	std::string message = "[";
+	bool firstIndividual = true;
+	int sent = 0;
+	for (unsigned int i = 0; i < robots.size(); i++) {
+		++sent;
+		FakeJSSocket socket;
+		boost::shared_ptr<RobotRepresentation> currentRobot = robots[i];
+		currentRobot->evaluate(&socket, robotConf, simulationTime_,
+				startPositions_);
+		int ptrToIndividual = (int) currentRobot.get();
+		if (!firstIndividual) {
+			message += ",";
+		} else {
+			firstIndividual = false;
+		}
+		message += "{ptr:";
+		message += boost::lexical_cast<std::string>(ptrToIndividual);
+		message += ", packet : [";
+		bool firstByte = true;
+		std::vector<unsigned char> content = socket.getContent();
+		for (size_t k = 0 ; k < content.size(); ++k) {
+			if (!firstByte) {
+				message += ",";
+			} else {
+				firstByte = false;
+			}
+			message += boost::lexical_cast<std::string>((int) content[k]);
+		}
+		message += "]}";
+	}
+	message += "]";
+	sendJSEvent("needsEvaluation", message);
+	std::cout << sent << " inidividual sent to the javascript scheduler" << std::endl;
+
+#else
+	BatchStream stream(robots);
+	evaluate(stream, robotConf);
+#endif
+}
+
+void SocketEvaluator::evaluate(EvaluationStream &stream,
+		boost::shared_ptr<RobogenConfig> robotConf) {
+
+#ifdef EMSCRIPTEN
+	std::cerr << "Streamed evaluations are not supported by the javascript "
+			<< "scheduler" << std::endl;
+#else
+
+	// 1. Serialize access to the stream
+	boost::mutex streamMutex;
+
+	// 2. Prepare thread structure
+	boost::thread_group evaluators;
+
+	// 3. Launch threads
+	for (unsigned int i = 0; i < sockets_.size(); i++) {
+		evaluators.add_thread(
+				new boost::thread(evaluationThread, boost::ref(stream),
+						boost::ref(streamMutex), boost::ref(*sockets_[i]),
+						robotConf, simulationTime_, startPositions_));
+	}
+
+	// 4. Join threads. The stream is now exhausted.
+	evaluators.join_all();
+
+	// newline after per-individual dots
+	std::cout << std::endl;
+#endif
+}
+
+} /* namespace robogen */
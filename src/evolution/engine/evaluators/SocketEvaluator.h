@@ -0,0 +1,66 @@
+/*
+ * @(#) SocketEvaluator.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_SOCKET_EVALUATOR_H_
+#define ROBOGEN_SOCKET_EVALUATOR_H_
+
+#include <vector>
+#include "evolution/engine/Evaluator.h"
+#include "utils/network/TcpSocket.h"
+
+namespace robogen {
+
+/**
+ * Sends individuals to simulator servers (robogen-server), one thread per
+ * socket.  In the javascript build, individuals are handed over to the
+ * javascript scheduler instead.
+ */
+class SocketEvaluator : public Evaluator {
+public:
+	/**
+	 * @param sockets connections to the simulator servers, not owned
+	 */
+	SocketEvaluator(std::vector<Socket*> &sockets);
+
+	virtual void evaluate(
+			const std::vector<boost::shared_ptr<RobotRepresentation> > &robots,
+			boost::shared_ptr<RobogenConfig> robotConf);
+
+	virtual void evaluate(EvaluationStream &stream,
+			boost::shared_ptr<RobogenConfig> robotConf);
+
+	virtual ~SocketEvaluator();
+
+private:
+	/**
+	 * Connections to the simulator servers
+	 */
+	std::vector<Socket*> &sockets_;
+};
+
+} /* namespace robogen */
+#endif /* ROBOGEN_SOCKET_EVALUATOR_H_ */
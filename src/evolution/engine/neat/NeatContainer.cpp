@@ -122,6 +122,27 @@ bool NeatContainer::produceNextGeneration(boost::shared_ptr<Population>
 		}
 	}
 
+	// genomes whose robot kept a low fidelity fitness get fitnesses below
+	// the lowest fully evaluated one, spread by their rank
+	double lowestFull = -1;
+	std::vector<std::pair<double, unsigned int> > lowFidelity;
+	for(NeatIdToGenomeMap::iterator i = neatIdToGenomeMap_.begin();
+				i != neatIdToGenomeMap_.end(); i++) {
+		if (neatIdToRobotMap_[i->first]->isLowFidelity()) {
+			lowFidelity.push_back(std::make_pair(i->second->GetFitness(),
+					i->first));
+		} else if (lowestFull < 0 || i->second->GetFitness() < lowestFull) {
+			lowestFull = i->second->GetFitness();
+		}
+	}
+	if (lowestFull > 0 && !lowFidelity.empty()) {
+		std::sort(lowFidelity.begin(), lowFidelity.end());
+		for (unsigned int i = 0; i < lowFidelity.size(); ++i) {
+			neatIdToGenomeMap_[lowFidelity[i].second]->SetFitness(
+					lowestFull * (i + 1) / (lowFidelity.size() + 1));
+		}
+	}
+
 	//std::cout << "before epoch size is " << neatIdToGenomeMap_.size()
 	//		<< " " << neatIdToRobotMap_.size() << std::endl;
 	//printCurrentIds();
@@ -30,8 +30,7 @@
 #include "DeterministicTournament.h"
 #include <algorithm>
 #include <boost/random/mersenne_twister.hpp>
-#include <boost/random/uniform_int.hpp>
-#include <boost/random/variate_generator.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
 
 namespace robogen {
 
@@ -48,43 +47,41 @@ void DeterministicTournament::initPopulation(
 	population_ = pop;
 }
 
-// http://sureshamrita.wordpress.com/2011/08/27/random_shuffle-boost-generator/
 bool DeterministicTournament::select(boost::shared_ptr<RobotRepresentation>
 								&selected) {
 
-	if (!population_) {
+	if (!population_ || population_->empty()) {
 		std::cout << "Trying to perform selection, but no "
 				"population initiated!" << std::endl;
 		return false;
 	}
 
-	// prepare stuff for random_shuffle
-	boost::uniform_int<> uni_dist;
-	boost::variate_generator<boost::mt19937&, boost::uniform_int<> > randomNumber(
-			rng_, uni_dist);
-
-	// prepare a pointer vector for a random shuffle
-	std::vector<boost::shared_ptr<RobotRepresentation> > shuffVec;
-	for (unsigned int i = 0; i < population_->size(); i++) {
-		shuffVec.push_back(population_->at(i));
+	// let tSize_ distinct robots "compete", drawn with Floyd's algorithm so
+	// the cost does not depend on the population size
+	unsigned int n = population_->size();
+	unsigned int k = std::min(tSize_, n);
+	contestants_.clear();
+	for (unsigned int j = n - k; j < n; ++j) {
+		boost::random::uniform_int_distribution<unsigned int> dist(0, j);
+		unsigned int drawn = dist(rng_);
+		if (std::find(contestants_.begin(), contestants_.end(), drawn) !=
+				contestants_.end()) {
+			drawn = j;
+		}
+		contestants_.push_back(drawn);
 	}
-	// let tSize_ robots "compete"
 
-	unsigned int selectionIndex = 0;
-	// shuffle robots -> first tSize are in tournament
-	std::random_shuffle(shuffVec.begin(), shuffVec.end(), randomNumber);
-	for (unsigned int i = 1; i < tSize_; i++) {
-		if (shuffVec[i]->getFitness()
-				> shuffVec[selectionIndex]->getFitness()) {
-			selectionIndex = i;
+	unsigned int selectionIndex = contestants_[0];
+	for (unsigned int i = 1; i < contestants_.size(); i++) {
+		if (robotFitnessComparator(population_->at(contestants_[i]),
+				population_->at(selectionIndex))) {
+			selectionIndex = contestants_[i];
 		}
 	}
 
-	selected = shuffVec[selectionIndex];
-
+	selected = population_->at(selectionIndex);
 
 	return true;
 }
 
 }
-
@@ -31,6 +31,7 @@
 #define DETERMINISTICTOURNAMENT_H_
 
 #include <utility>
+#include <vector>
 #include "evolution/engine/Selector.h"
 
 namespace robogen{
@@ -71,6 +72,11 @@ private:
 	 */
 	unsigned int tSize_;
 
+	/**
+	 * Indices of the participants of the current tournament
+	 */
+	std::vector<unsigned int> contestants_;
+
 	/**
 	 * Random number generator reference
 	 */
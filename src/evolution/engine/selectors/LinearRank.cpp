@@ -0,0 +1,82 @@
+/*
+ * @(#) LinearRank.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#include "evolution/engine/selectors/LinearRank.h"
+#include <algorithm>
+#include <iostream>
+#include <boost/random/uniform_real_distribution.hpp>
+
+namespace robogen {
+
+LinearRank::LinearRank(double pressure, boost::random::mt19937 &rng) :
+		pressure_(pressure), rng_(rng) {
+}
+
+LinearRank::~LinearRank() {
+}
+
+void LinearRank::initPopulation(boost::shared_ptr<Population> pop) {
+
+	population_ = pop;
+	population_->sort();
+
+	unsigned int n = population_->size();
+	cumulative_.resize(n);
+	double sum = 0;
+	for (unsigned int rank = 0; rank < n; ++rank) {
+		double probability = 1.0 / n;
+		if (n > 1) {
+			probability = (pressure_ - (2 * pressure_ - 2) * rank / (n - 1))
+					/ n;
+		}
+		sum += probability;
+		cumulative_[rank] = sum;
+	}
+	if (n > 0) {
+		cumulative_[n - 1] = 1;
+	}
+}
+
+bool LinearRank::select(boost::shared_ptr<RobotRepresentation> &selected) {
+
+	if (!population_ || population_->empty()) {
+		std::cout << "Trying to perform selection, but no "
+				"population initiated!" << std::endl;
+		return false;
+	}
+
+	boost::random::uniform_real_distribution<double> dist(0, 1);
+	unsigned int rank = std::upper_bound(cumulative_.begin(),
+			cumulative_.end(), dist(rng_)) - cumulative_.begin();
+	rank = std::min(rank, (unsigned int) population_->size() - 1);
+
+	selected = population_->at(rank);
+	return true;
+}
+
+}
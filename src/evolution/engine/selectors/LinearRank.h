@@ -0,0 +1,87 @@
+/*
+ * @(#) LinearRank.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_LINEAR_RANK_H_
+#define ROBOGEN_LINEAR_RANK_H_
+
+#include <vector>
+#include "evolution/engine/Selector.h"
+
+namespace robogen {
+
+/**
+ * Linear ranking selection (Baker): the probability of selecting an
+ * individual decreases linearly with its rank, from pressure / N for the
+ * best to (2 - pressure) / N for the worst, whatever the fitness values.
+ *
+ * The ranking and the cumulative probabilities are computed once per
+ * population, each selection is then a binary search.
+ */
+class LinearRank : public Selector {
+public:
+	/**
+	 * @param pressure selection pressure, in [1, 2]
+	 * @param rng random number generator reference
+	 */
+	LinearRank(double pressure, boost::random::mt19937 &rng);
+
+	virtual ~LinearRank();
+
+	/**
+	 * Ranks the population and builds the cumulative probabilities
+	 */
+	virtual void initPopulation(boost::shared_ptr<Population> pop);
+
+	/**
+	 * Selects a parent with probability linear in its rank
+	 */
+	virtual bool select(boost::shared_ptr<RobotRepresentation> &selected);
+
+private:
+	/**
+	 * Selection pool population, sorted best first
+	 */
+	boost::shared_ptr<Population> population_;
+
+	/**
+	 * Cumulative selection probability of each rank
+	 */
+	std::vector<double> cumulative_;
+
+	/**
+	 * Selection pressure
+	 */
+	double pressure_;
+
+	/**
+	 * Random number generator reference
+	 */
+	boost::random::mt19937 &rng_;
+};
+
+}
+#endif /* ROBOGEN_LINEAR_RANK_H_ */
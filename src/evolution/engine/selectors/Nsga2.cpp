@@ -0,0 +1,313 @@
+/*
+ * @(#) Nsga2.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include "evolution/engine/selectors/Nsga2.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <boost/random/uniform_int_distribution.hpp>
+
+namespace robogen {
+
+namespace {
+
+/**
+ * @return true if a dominates b: at least as good on every objective and
+ * 		better on one
+ */
+bool dominates(const std::vector<double> &a, const std::vector<double> &b) {
+	bool better = false;
+	for (unsigned int i = 0; i < a.size(); ++i) {
+		if (a[i] < b[i]) {
+			return false;
+		}
+		if (a[i] > b[i]) {
+			better = true;
+		}
+	}
+	return better;
+}
+
+/**
+ * Orders individuals by decreasing objectives, lexicographically
+ */
+class LexicographicComparator {
+public:
+	LexicographicComparator(const std::vector<std::vector<double> > &objectives)
+			: objectives_(objectives) {
+	}
+	bool operator()(unsigned int a, unsigned int b) const {
+		return objectives_[a] > objectives_[b];
+	}
+private:
+	const std::vector<std::vector<double> > &objectives_;
+};
+
+/**
+ * Orders the individuals of a front by one objective
+ */
+class ObjectiveComparator {
+public:
+	ObjectiveComparator(const std::vector<std::vector<double> > &objectives,
+			const std::vector<unsigned int> &front, unsigned int objective)
+			: objectives_(objectives), front_(front), objective_(objective) {
+	}
+	bool operator()(unsigned int a, unsigned int b) const {
+		return objectives_[front_[a]][objective_] <
+				objectives_[front_[b]][objective_];
+	}
+private:
+	const std::vector<std::vector<double> > &objectives_;
+	const std::vector<unsigned int> &front_;
+	unsigned int objective_;
+};
+
+/**
+ * Orders the individuals of a front by decreasing crowding distance
+ */
+bool crowdingComparator(const std::pair<double, unsigned int> &a,
+		const std::pair<double, unsigned int> &b) {
+	return a.first > b.first;
+}
+
+}
+
+Nsga2::Nsga2(unsigned int tSize, boost::random::mt19937 &rng) :
+		tSize_(tSize), rng_(rng) {
+}
+
+Nsga2::~Nsga2() {
+}
+
+std::vector<std::vector<double> > Nsga2::getObjectives(
+		const std::vector<boost::shared_ptr<RobotRepresentation> >
+		&individuals) {
+
+	size_t nObjectives = 1;
+	for (unsigned int i = 0; i < individuals.size(); ++i) {
+		nObjectives = std::max(nObjectives,
+				individuals[i]->getObjectives().size());
+	}
+
+	std::vector<std::vector<double> > objectives(individuals.size());
+	for (unsigned int i = 0; i < individuals.size(); ++i) {
+		if (individuals[i]->getObjectives().size() == nObjectives) {
+			objectives[i] = individuals[i]->getObjectives();
+		} else {
+			objectives[i].assign(nObjectives, individuals[i]->getFitness());
+		}
+	}
+	return objectives;
+}
+
+void Nsga2::sortFronts(const std::vector<std::vector<double> > &objectives,
+		std::vector<std::vector<unsigned int> > &fronts) {
+
+	fronts.clear();
+	std::vector<unsigned int> order(objectives.size());
+	for (unsigned int i = 0; i < order.size(); ++i) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(),
+			LexicographicComparator(objectives));
+
+	for (unsigned int i = 0; i < order.size(); ++i) {
+		const std::vector<double> &current = objectives[order[i]];
+
+		// if dominated by some individual of a front, it is also dominated
+		// by some individual of every better front
+		unsigned int low = 0, high = fronts.size();
+		while (low < high) {
+			unsigned int middle = (low + high) / 2;
+			bool dominated = false;
+			// the last individuals added are the closest to the current one
+			for (int j = fronts[middle].size() - 1; j >= 0 && !dominated;
+					--j) {
+				dominated = dominates(objectives[fronts[middle][j]], current);
+			}
+			if (dominated) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+
+		if (low == fronts.size()) {
+			fronts.push_back(std::vector<unsigned int>());
+		}
+		fronts[low].push_back(order[i]);
+	}
+}
+
+void Nsga2::sortFronts(
+		const std::vector<boost::shared_ptr<RobotRepresentation> >
+		&individuals,
+		const std::vector<std::vector<double> > &objectives,
+		std::vector<std::vector<unsigned int> > &fronts) {
+
+	fronts.clear();
+	for (int lowFidelity = 0; lowFidelity < 2; ++lowFidelity) {
+		std::vector<unsigned int> members;
+		std::vector<std::vector<double> > memberObjectives;
+		for (unsigned int i = 0; i < individuals.size(); ++i) {
+			if (individuals[i]->isLowFidelity() == (lowFidelity == 1)) {
+				members.push_back(i);
+				memberObjectives.push_back(objectives[i]);
+			}
+		}
+
+		std::vector<std::vector<unsigned int> > memberFronts;
+		sortFronts(memberObjectives, memberFronts);
+		for (unsigned int f = 0; f < memberFronts.size(); ++f) {
+			fronts.push_back(std::vector<unsigned int>());
+			for (unsigned int i = 0; i < memberFronts[f].size(); ++i) {
+				fronts.back().push_back(members[memberFronts[f][i]]);
+			}
+		}
+	}
+}
+
+void Nsga2::crowdingDistances(
+		const std::vector<std::vector<double> > &objectives,
+		const std::vector<unsigned int> &front,
+		std::vector<double> &distances) {
+
+	distances.assign(front.size(), 0);
+	if (front.size() <= 2) {
+		std::fill(distances.begin(), distances.end(),
+				std::numeric_limits<double>::infinity());
+		return;
+	}
+
+	std::vector<unsigned int> order(front.size());
+	for (unsigned int m = 0; m < objectives[front[0]].size(); ++m) {
+		for (unsigned int i = 0; i < order.size(); ++i) {
+			order[i] = i;
+		}
+		std::sort(order.begin(), order.end(),
+				ObjectiveComparator(objectives, front, m));
+
+		double lowest = objectives[front[order.front()]][m];
+		double highest = objectives[front[order.back()]][m];
+		distances[order.front()] = std::numeric_limits<double>::infinity();
+		distances[order.back()] = std::numeric_limits<double>::infinity();
+		if (highest <= lowest) {
+			continue;
+		}
+		for (unsigned int i = 1; i + 1 < order.size(); ++i) {
+			distances[order[i]] += (objectives[front[order[i + 1]]][m] -
+					objectives[front[order[i - 1]]][m]) / (highest - lowest);
+		}
+	}
+}
+
+void Nsga2::reduce(
+		std::vector<boost::shared_ptr<RobotRepresentation> > &individuals,
+		unsigned int popSize) {
+
+	if (individuals.size() <= popSize) {
+		return;
+	}
+
+	std::vector<std::vector<double> > objectives = getObjectives(individuals);
+	std::vector<std::vector<unsigned int> > fronts;
+	sortFronts(individuals, objectives, fronts);
+
+	std::vector<boost::shared_ptr<RobotRepresentation> > kept;
+	for (unsigned int f = 0; f < fronts.size() && kept.size() < popSize;
+			++f) {
+		if (kept.size() + fronts[f].size() <= popSize) {
+			for (unsigned int i = 0; i < fronts[f].size(); ++i) {
+				kept.push_back(individuals[fronts[f][i]]);
+			}
+		} else {
+			// last front that fits partially: keep the least crowded
+			std::vector<double> distances;
+			crowdingDistances(objectives, fronts[f], distances);
+			std::vector<std::pair<double, unsigned int> > ranking;
+			for (unsigned int i = 0; i < fronts[f].size(); ++i) {
+				ranking.push_back(std::make_pair(distances[i], fronts[f][i]));
+			}
+			std::stable_sort(ranking.begin(), ranking.end(),
+					crowdingComparator);
+			for (unsigned int i = 0; kept.size() < popSize; ++i) {
+				kept.push_back(individuals[ranking[i].second]);
+			}
+		}
+	}
+
+	individuals.swap(kept);
+}
+
+void Nsga2::initPopulation(boost::shared_ptr<Population> pop) {
+	population_ = pop;
+
+	std::vector<std::vector<double> > objectives = getObjectives(*pop);
+	std::vector<std::vector<unsigned int> > fronts;
+	sortFronts(*pop, objectives, fronts);
+
+	ranks_.assign(pop->size(), 0);
+	crowding_.assign(pop->size(), 0);
+	for (unsigned int f = 0; f < fronts.size(); ++f) {
+		std::vector<double> distances;
+		crowdingDistances(objectives, fronts[f], distances);
+		for (unsigned int i = 0; i < fronts[f].size(); ++i) {
+			ranks_[fronts[f][i]] = f;
+			crowding_[fronts[f][i]] = distances[i];
+		}
+	}
+
+	std::cout << "NSGA-II: " << fronts.size() << " fronts, "
+			<< (fronts.empty() ? 0 : fronts[0].size())
+			<< " non-dominated individuals" << std::endl;
+}
+
+bool Nsga2::select(boost::shared_ptr<RobotRepresentation> &selected) {
+
+	if (!population_ || population_->empty()) {
+		std::cout << "Trying to perform selection, but no "
+				"population initiated!" << std::endl;
+		return false;
+	}
+
+	boost::random::uniform_int_distribution<unsigned int> dist(0,
+			population_->size() - 1);
+	unsigned int winner = dist(rng_);
+	for (unsigned int i = 1; i < tSize_; ++i) {
+		unsigned int challenger = dist(rng_);
+		if (ranks_[challenger] < ranks_[winner] ||
+				(ranks_[challenger] == ranks_[winner] &&
+				crowding_[challenger] > crowding_[winner])) {
+			winner = challenger;
+		}
+	}
+
+	selected = population_->at(winner);
+	return true;
+}
+
+}
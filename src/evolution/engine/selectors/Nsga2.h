@@ -0,0 +1,148 @@
+/*
+ * @(#) Nsga2.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_NSGA2_H_
+#define ROBOGEN_NSGA2_H_
+
+#include <vector>
+#include "evolution/engine/Selector.h"
+
+namespace robogen {
+
+/**
+ * NSGA-II selection on the objectives returned by the scenario (all
+ * maximized). Individuals without objectives, e.g. because they violated a
+ * constraint, count as having their fitness for every objective; if no
+ * individual has objectives this is a selection on the fitness.
+ *
+ * Parents are drawn by tournament on (front, crowding distance), and
+ * reduce() replaces the truncation to the mu best when building the next
+ * population.
+ */
+class Nsga2 : public Selector {
+public:
+	/**
+	 * @param tSize number of individuals in each tournament
+	 * @param rng random number generator reference
+	 */
+	Nsga2(unsigned int tSize, boost::random::mt19937 &rng);
+
+	virtual ~Nsga2();
+
+	/**
+	 * Ranks the population into fronts and computes crowding distances
+	 */
+	virtual void initPopulation(boost::shared_ptr<Population> pop);
+
+	/**
+	 * Selects a parent by crowded tournament
+	 */
+	virtual bool select(boost::shared_ptr<RobotRepresentation> &selected);
+
+	/**
+	 * Keeps the popSize best individuals by front, then by crowding distance
+	 * within the last front that fits
+	 * @param individuals evaluated individuals, reduced in place
+	 * @param popSize number of individuals to keep
+	 */
+	static void reduce(
+			std::vector<boost::shared_ptr<RobotRepresentation> > &individuals,
+			unsigned int popSize);
+
+	/**
+	 * Non-dominated sorting by the ENS-BS procedure (Zhang et al. 2015):
+	 * after a lexicographic sort, an individual can only be dominated by
+	 * earlier ones, and its front is found by binary search over the fronts
+	 * built so far. Much fewer comparisons than the O(MN^2) original.
+	 * @param objectives objective vectors, all of the same size
+	 * @param fronts filled with the indices of the individuals of each front,
+	 * 		best front first
+	 */
+	static void sortFronts(const std::vector<std::vector<double> > &objectives,
+			std::vector<std::vector<unsigned int> > &fronts);
+
+	/**
+	 * Crowding distance of the individuals of one front
+	 * @param objectives objective vectors of all individuals
+	 * @param front indices of the individuals of the front
+	 * @param distances filled with the distance of each individual of the
+	 * 		front, in the same order, infinite at the boundaries
+	 */
+	static void crowdingDistances(
+			const std::vector<std::vector<double> > &objectives,
+			const std::vector<unsigned int> &front,
+			std::vector<double> &distances);
+
+private:
+	/**
+	 * Non-dominated sorting of individuals, where the fronts of the fully
+	 * evaluated individuals all come before the fronts of the ones that kept
+	 * a low fidelity fitness
+	 * @param individuals evaluated individuals
+	 * @param objectives their objective vectors
+	 * @param fronts filled with the indices of the individuals of each front,
+	 * 		best front first
+	 */
+	static void sortFronts(
+			const std::vector<boost::shared_ptr<RobotRepresentation> >
+			&individuals,
+			const std::vector<std::vector<double> > &objectives,
+			std::vector<std::vector<unsigned int> > &fronts);
+
+	/**
+	 * Objective vectors of individuals, padded with their fitness if they
+	 * have none
+	 */
+	static std::vector<std::vector<double> > getObjectives(
+			const std::vector<boost::shared_ptr<RobotRepresentation> >
+			&individuals);
+
+	/**
+	 * Selection pool population
+	 */
+	boost::shared_ptr<Population> population_;
+
+	/**
+	 * Front and crowding distance of each individual of the pool
+	 */
+	std::vector<unsigned int> ranks_;
+	std::vector<double> crowding_;
+
+	/**
+	 * Tournament size
+	 */
+	unsigned int tSize_;
+
+	/**
+	 * Random number generator reference
+	 */
+	boost::random::mt19937 &rng_;
+};
+
+}
+
+#endif /* ROBOGEN_NSGA2_H_ */
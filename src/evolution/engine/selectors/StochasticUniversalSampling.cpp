@@ -0,0 +1,133 @@
+/*
+ * @(#) StochasticUniversalSampling.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#include "evolution/engine/selectors/StochasticUniversalSampling.h"
+#include <algorithm>
+#include <iostream>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+namespace robogen {
+
+StochasticUniversalSampling::StochasticUniversalSampling(
+		boost::random::mt19937 &rng) : next_(0), rng_(rng) {
+}
+
+StochasticUniversalSampling::~StochasticUniversalSampling() {
+}
+
+void StochasticUniversalSampling::initPopulation(
+		boost::shared_ptr<Population> pop) {
+
+	population_ = pop;
+	batch_.clear();
+	next_ = 0;
+
+	// individuals with a low fidelity fitness rank below the fully
+	// evaluated ones, so they are only drawn if there are no others
+	unsigned int n = population_->size();
+	bool lowFidelityOnly = true;
+	for (unsigned int i = 0; i < n; ++i) {
+		lowFidelityOnly &= population_->at(i)->isLowFidelity();
+	}
+
+	double worst = 0;
+	bool first = true;
+	for (unsigned int i = 0; i < n; ++i) {
+		if (population_->at(i)->isLowFidelity() && !lowFidelityOnly) {
+			continue;
+		}
+		double fitness = population_->at(i)->getFitness();
+		if (first || fitness < worst) {
+			worst = fitness;
+			first = false;
+		}
+	}
+
+	cumulative_.resize(n);
+	double sum = 0;
+	for (unsigned int i = 0; i < n; ++i) {
+		if (!population_->at(i)->isLowFidelity() || lowFidelityOnly) {
+			sum += population_->at(i)->getFitness() - worst;
+		}
+		cumulative_[i] = sum;
+	}
+
+	// all equal: uniform selection
+	if (sum <= 0) {
+		for (unsigned int i = 0; i < n; ++i) {
+			if (!population_->at(i)->isLowFidelity() || lowFidelityOnly) {
+				++sum;
+			}
+			cumulative_[i] = sum;
+		}
+	}
+}
+
+void StochasticUniversalSampling::sample() {
+
+	unsigned int n = cumulative_.size();
+	double spacing = cumulative_.back() / n;
+	boost::random::uniform_real_distribution<double> offset(0, spacing);
+	double pointer = offset(rng_);
+
+	// one pass: pointers and cumulative fitness are both increasing
+	batch_.resize(n);
+	unsigned int individual = 0;
+	for (unsigned int i = 0; i < n; ++i, pointer += spacing) {
+		while (individual < n - 1 && cumulative_[individual] <= pointer) {
+			++individual;
+		}
+		batch_[i] = individual;
+	}
+
+	// hand out the batch in random order (Fisher-Yates)
+	for (unsigned int i = n - 1; i > 0; --i) {
+		boost::random::uniform_int_distribution<unsigned int> dist(0, i);
+		std::swap(batch_[i], batch_[dist(rng_)]);
+	}
+	next_ = 0;
+}
+
+bool StochasticUniversalSampling::select(
+		boost::shared_ptr<RobotRepresentation> &selected) {
+
+	if (!population_ || population_->empty()) {
+		std::cout << "Trying to perform selection, but no "
+				"population initiated!" << std::endl;
+		return false;
+	}
+
+	if (next_ >= batch_.size()) {
+		sample();
+	}
+	selected = population_->at(batch_[next_++]);
+	return true;
+}
+
+}
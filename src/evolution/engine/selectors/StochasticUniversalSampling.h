@@ -0,0 +1,96 @@
+/*
+ * @(#) StochasticUniversalSampling.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_STOCHASTIC_UNIVERSAL_SAMPLING_H_
+#define ROBOGEN_STOCHASTIC_UNIVERSAL_SAMPLING_H_
+
+#include <vector>
+#include "evolution/engine/Selector.h"
+
+namespace robogen {
+
+/**
+ * Fitness proportional selection by stochastic universal sampling (Baker):
+ * a whole batch of parents is drawn with a single random offset and evenly
+ * spaced pointers, so each individual is selected within one of its
+ * expected number of times. Fitness is taken relative to the worst
+ * individual of the population (which is never selected), or uniformly if
+ * all are equal. Individuals that kept a low fidelity fitness are not
+ * selected, unless the population has no fully evaluated one.
+ *
+ * Batches of population size are drawn in one pass over the cumulative
+ * fitness, and handed out in random order.
+ */
+class StochasticUniversalSampling : public Selector {
+public:
+	/**
+	 * @param rng random number generator reference
+	 */
+	StochasticUniversalSampling(boost::random::mt19937 &rng);
+
+	virtual ~StochasticUniversalSampling();
+
+	/**
+	 * Builds the cumulative fitness of the population
+	 */
+	virtual void initPopulation(boost::shared_ptr<Population> pop);
+
+	/**
+	 * Selects the next parent of the current batch
+	 */
+	virtual bool select(boost::shared_ptr<RobotRepresentation> &selected);
+
+private:
+	/**
+	 * Draws a new batch of parents
+	 */
+	void sample();
+
+	/**
+	 * Selection pool population
+	 */
+	boost::shared_ptr<Population> population_;
+
+	/**
+	 * Cumulative fitness of the individuals of the pool
+	 */
+	std::vector<double> cumulative_;
+
+	/**
+	 * Indices of the parents of the current batch, and next one to hand out
+	 */
+	std::vector<unsigned int> batch_;
+	unsigned int next_;
+
+	/**
+	 * Random number generator reference
+	 */
+	boost::random::mt19937 &rng_;
+};
+
+}
+#endif /* ROBOGEN_STOCHASTIC_UNIVERSAL_SAMPLING_H_ */
@@ -0,0 +1,66 @@
+/*
+ * @(#) Truncation.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#include "evolution/engine/selectors/Truncation.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <boost/random/uniform_int_distribution.hpp>
+
+namespace robogen {
+
+Truncation::Truncation(double fraction, boost::random::mt19937 &rng) :
+		size_(0), fraction_(fraction), rng_(rng) {
+}
+
+Truncation::~Truncation() {
+}
+
+void Truncation::initPopulation(boost::shared_ptr<Population> pop) {
+
+	population_ = pop;
+	population_->sort();
+	// at least two, so that two different parents can be drawn
+	size_ = std::max(2, (int) std::ceil(fraction_ * population_->size()));
+}
+
+bool Truncation::select(boost::shared_ptr<RobotRepresentation> &selected) {
+
+	if (!population_ || population_->empty()) {
+		std::cout << "Trying to perform selection, but no "
+				"population initiated!" << std::endl;
+		return false;
+	}
+
+	boost::random::uniform_int_distribution<unsigned int> dist(0,
+			std::min(size_, (unsigned int) population_->size()) - 1);
+	selected = population_->at(dist(rng_));
+	return true;
+}
+
+}
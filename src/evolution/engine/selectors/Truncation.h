@@ -0,0 +1,82 @@
+/*
+ * @(#) Truncation.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_TRUNCATION_H_
+#define ROBOGEN_TRUNCATION_H_
+
+#include "evolution/engine/Selector.h"
+
+namespace robogen {
+
+/**
+ * Truncation selection: parents are drawn uniformly among the best fraction
+ * of the population
+ */
+class Truncation : public Selector {
+public:
+	/**
+	 * @param fraction fraction of the population selected from, in (0, 1]
+	 * @param rng random number generator reference
+	 */
+	Truncation(double fraction, boost::random::mt19937 &rng);
+
+	virtual ~Truncation();
+
+	/**
+	 * Ranks the population
+	 */
+	virtual void initPopulation(boost::shared_ptr<Population> pop);
+
+	/**
+	 * Selects a parent uniformly among the best ones
+	 */
+	virtual bool select(boost::shared_ptr<RobotRepresentation> &selected);
+
+private:
+	/**
+	 * Selection pool population, sorted best first
+	 */
+	boost::shared_ptr<Population> population_;
+
+	/**
+	 * Number of best individuals selected from
+	 */
+	unsigned int size_;
+
+	/**
+	 * Fraction of the population selected from
+	 */
+	double fraction_;
+
+	/**
+	 * Random number generator reference
+	 */
+	boost::random::mt19937 &rng_;
+};
+
+}
+#endif /* ROBOGEN_TRUNCATION_H_ */
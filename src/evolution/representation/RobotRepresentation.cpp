@@ -56,7 +56,7 @@
 namespace robogen {
 
 RobotRepresentation::RobotRepresentation() :
-		maxid_(1000), evaluated_(false) {
+		maxid_(1000), evaluated_(false), lowFidelity_(false) {
 
 }
 
@@ -89,7 +89,9 @@ RobotRepresentation::RobotRepresentation(const RobotRepresentation &r) {
 	}
 	// fitness and associated flag are same
 	fitness_ = r.fitness_;
+	objectives_ = r.objectives_;
 	evaluated_ = r.evaluated_;
+	lowFidelity_ = r.lowFidelity_;
 	maxid_ = r.maxid_;
 }
 
@@ -350,16 +352,29 @@ RobotRepresentation &RobotRepresentation::operator=(
 		}
 	}
 	fitness_ = r.fitness_;
+	objectives_ = r.objectives_;
 	evaluated_ = r.evaluated_;
+	lowFidelity_ = r.lowFidelity_;
 	maxid_ = r.maxid_;
 	return *this;
 }
 
 void RobotRepresentation::asyncEvaluateResult(double fitness) {
 	fitness_ = fitness;
+	objectives_.clear();
 	evaluated_ = true;
 }
 
+void RobotRepresentation::setEvaluationResult(double fitness,
+		const std::vector<double> &objectives,
+		const SimulationProfile &profile, bool lowFidelity) {
+	fitness_ = fitness;
+	objectives_ = objectives;
+	evaluated_ = true;
+	lowFidelity_ = lowFidelity;
+	profile_ = profile;
+}
+
 bool RobotRepresentation::init() {
 
 	// Generate a core component
@@ -567,6 +582,155 @@ bool RobotRepresentation::init(std::string robotTextFile) {
 	return true;
 }
 
+bool RobotRepresentation::init(const robogenMessage::Robot &robotMessage) {
+
+	const robogenMessage::Body &bodyMessage = robotMessage.body();
+
+	// create parts, bringing parameters back to [0,1]
+	idToPart_.clear();
+	bodyTree_.reset();
+	std::map<std::string, boost::shared_ptr<PartRepresentation> > parts;
+	for (int i = 0; i < bodyMessage.part_size(); ++i) {
+		const robogenMessage::BodyPart &partMessage = bodyMessage.part(i);
+		std::map<std::string, char>::const_iterator type =
+				INVERSE_PART_TYPE_MAP.find(partMessage.type());
+		if (type == INVERSE_PART_TYPE_MAP.end()) {
+			std::cout << "Unknown part type " << partMessage.type()
+					<< std::endl;
+			return false;
+		}
+		std::vector<double> params;
+		for (int j = 0; j < partMessage.evolvableparam_size(); ++j) {
+			std::pair<double, double> ranges = PART_TYPE_PARAM_RANGE_MAP.at(
+					std::make_pair(partMessage.type(), j));
+			double paramValue = partMessage.evolvableparam(j).paramvalue();
+			params.push_back((fabs(ranges.first - ranges.second) < 1e-6)
+					? 0 : (paramValue - ranges.first) /
+							(ranges.second - ranges.first));
+		}
+		boost::shared_ptr<PartRepresentation> part =
+				PartRepresentation::create(type->second, partMessage.id(),
+						partMessage.orientation(), params);
+		if (!part) {
+			std::cout << "Failed to create part " << partMessage.id()
+					<< std::endl;
+			return false;
+		}
+		parts[partMessage.id()] = part;
+		idToPart_[partMessage.id()] = boost::weak_ptr<PartRepresentation>(
+				part);
+		if (partMessage.root()) {
+			bodyTree_ = part;
+		}
+	}
+	if (!bodyTree_) {
+		std::cout << "Robot message has no root part" << std::endl;
+		return false;
+	}
+
+	// connect them, slots are shifted for all but the core (see
+	// PartRepresentation::addSubtreeToBodyMessage())
+	for (int i = 0; i < bodyMessage.connection_size(); ++i) {
+		const robogenMessage::BodyConnection &connection =
+				bodyMessage.connection(i);
+		if (!parts.count(connection.src()) ||
+				!parts.count(connection.dest())) {
+			std::cout << "Connection between unknown parts "
+					<< connection.src() << " and " << connection.dest()
+					<< std::endl;
+			return false;
+		}
+		boost::shared_ptr<PartRepresentation> parent =
+				parts[connection.src()];
+		unsigned int slot = isCore(parent->getType()) ?
+				connection.srcslot() : connection.srcslot() - 1;
+		if (!parent->setChild(slot, parts[connection.dest()])) {
+			std::cout << "Failed to set child." << std::endl;
+			return false;
+		}
+	}
+
+	// brain: io neurons follow from the body, hidden ones are added
+	std::map<std::string, int> sensorMap, motorMap;
+	for (IdPartMap::iterator it = idToPart_.begin(); it != idToPart_.end();
+			++it) {
+		if (it->second.lock()->getMotors().size()) {
+			motorMap[it->first] = it->second.lock()->getMotors().size();
+		}
+		if (it->second.lock()->getSensors().size()) {
+			sensorMap[it->first] = it->second.lock()->getSensors().size();
+		}
+	}
+	neuralNetwork_.reset(new NeuralNetworkRepresentation(sensorMap, motorMap));
+
+	const robogenMessage::Brain &brainMessage = robotMessage.brain();
+	std::map<std::string, ioPair> neuronIds;
+	for (int i = 0; i < brainMessage.neuron_size(); ++i) {
+		const robogenMessage::Neuron &neuron = brainMessage.neuron(i);
+		ioPair identification(neuron.bodypartid(), neuron.ioid());
+		neuronIds[neuron.id()] = identification;
+
+		unsigned int type;
+		std::vector<double> params;
+		if (neuron.type() == "simple") {
+			type = NeuronRepresentation::SIMPLE;
+		} else if (neuron.type() == "sigmoid") {
+			type = NeuronRepresentation::SIGMOID;
+			params.push_back(neuron.bias());
+		} else if (neuron.type() == "ctrnn_sigmoid") {
+			type = NeuronRepresentation::CTRNN_SIGMOID;
+			params.push_back(neuron.bias());
+			params.push_back(neuron.tau());
+		} else if (neuron.type() == "oscillator") {
+			type = NeuronRepresentation::OSCILLATOR;
+			params.push_back(neuron.period());
+			params.push_back(neuron.phaseoffset());
+			params.push_back(neuron.gain());
+		} else {
+			std::cout << "Unknown neuron type " << neuron.type() << std::endl;
+			return false;
+		}
+
+		if (neuron.layer() == "hidden") {
+			neuralNetwork_->insertNeuron(identification,
+					NeuronRepresentation::HIDDEN, type);
+		}
+		if (neuron.layer() != "input" && !neuralNetwork_->setParams(
+				identification.first, identification.second, type, params)) {
+			return false;
+		}
+	}
+
+	for (int i = 0; i < brainMessage.connection_size(); ++i) {
+		const robogenMessage::NeuralConnection &connection =
+				brainMessage.connection(i);
+		if (!neuronIds.count(connection.src()) ||
+				!neuronIds.count(connection.dest())) {
+			std::cout << "Connection between unknown neurons "
+					<< connection.src() << " and " << connection.dest()
+					<< std::endl;
+			return false;
+		}
+		if (!neuralNetwork_->setWeight(neuronIds[connection.src()],
+				neuronIds[connection.dest()], connection.weight())) {
+			return false;
+		}
+	}
+
+	// same as when loading from a text file, new ids must not collide
+	maxid_ = 1000;
+	for(IdPartMap::iterator i = idToPart_.begin(); i!= idToPart_.end(); ++i) {
+		if(i->first.substr(0,4).compare("myid") == 0) {
+			int idVal = atoi(i->first.substr(4).c_str());
+			if (idVal >= maxid_) {
+				maxid_ = idVal + 1;
+			}
+		}
+	}
+
+	return true;
+}
+
 robogenMessage::Robot RobotRepresentation::serialize() const {
 	robogenMessage::Robot message;
 	// id - this can probably be removed
@@ -599,7 +763,8 @@ const std::string& RobotRepresentation::getBodyRootId() {
 }
 
 void RobotRepresentation::evaluate(Socket *socket,
-		boost::shared_ptr<RobogenConfig> robotConf) {
+		boost::shared_ptr<RobogenConfig> robotConf, float simulationTime,
+		unsigned int startPositions) {
 
 	// 1. Prepare message to simulator
 	boost::shared_ptr<robogenMessage::EvaluationRequest> evalReq(
@@ -608,6 +773,13 @@ void RobotRepresentation::evaluate(Socket *socket,
 	robogenMessage::SimulatorConf* evalConf = evalReq->mutable_configuration();
 	*evalRobot = serialize();
 	*evalConf = robotConf->serialize();
+	if (simulationTime > 0) {
+		evalReq->set_simulationtime(simulationTime);
+	}
+	if (startPositions > 0) {
+		evalReq->set_startpositions(startPositions);
+	}
+	lowFidelity_ = (simulationTime > 0 || startPositions > 0);
 
 	ProtobufPacket<robogenMessage::EvaluationRequest> robotPacket(evalReq);
 	std::vector<unsigned char> forgedMessagePacket;
@@ -643,6 +815,12 @@ void RobotRepresentation::evaluate(Socket *socket,
 		fitness_ = resultPacket.getMessage()->fitness();
 		evaluated_ = true;
 	}
+	objectives_.assign(resultPacket.getMessage()->objectives().begin(),
+			resultPacket.getMessage()->objectives().end());
+	profile_.reset();
+	if (resultPacket.getMessage()->has_profile()) {
+		profile_.merge(resultPacket.getMessage()->profile());
+	}
 #endif
 
 }
@@ -651,10 +829,22 @@ double RobotRepresentation::getFitness() const {
 	return fitness_;
 }
 
+const std::vector<double> &RobotRepresentation::getObjectives() const {
+	return objectives_;
+}
+
+const SimulationProfile &RobotRepresentation::getProfile() const {
+	return profile_;
+}
+
 bool RobotRepresentation::isEvaluated() const {
 	return evaluated_;
 }
 
+bool RobotRepresentation::isLowFidelity() const {
+	return lowFidelity_;
+}
+
 void RobotRepresentation::setDirty() {
 	evaluated_ = false;
 }
@@ -34,6 +34,7 @@
 #else
 
 #include <string>
+#include <vector>
 #include <set>
 #include <stdexcept>
 #include <boost/shared_ptr.hpp>
@@ -44,6 +45,7 @@
 #include "evolution/representation/PartRepresentation.h"
 #include "evolution/representation/NeuralNetworkRepresentation.h"
 #include "utils/network/TcpSocket.h"
+#include "utils/SimulationProfile.h"
 #include "robogen.pb.h"
 
 namespace robogen {
@@ -91,6 +93,13 @@ public:
 	 */
 	bool init(std::string robotTextFile);
 
+	/**
+	 * Initializes a robot from its serialization, as produced by serialize()
+	 * @param robotMessage
+	 * @return true if successful
+	 */
+	bool init(const robogenMessage::Robot &robotMessage);
+
 	/**
 	 * @return robot message of this robot to be transmitted to simulator
 	 * or stored as population checkpoint
@@ -121,20 +130,40 @@ public:
 	 * Evaluate individual using given socket and given configuration file.
 	 * @param socket
 	 * @param robotConf
+	 * @param simulationTime if > 0, simulate only for this long (s)
+	 * @param startPositions if > 0, use only this many start positions
 	 */
 	void evaluate(Socket *socket,
-			boost::shared_ptr<RobogenConfig> robotConf);
+			boost::shared_ptr<RobogenConfig> robotConf,
+			float simulationTime = 0, unsigned int startPositions = 0);
 
 	/**
 	 * @return fitness of individual
 	 */
 	double getFitness() const;
 
+	/**
+	 * @return objectives reported by the scenario for multi-objective
+	 * 		evolution, empty if the scenario only provides a fitness
+	 */
+	const std::vector<double> &getObjectives() const;
+
+	/**
+	 * @return the simulation profile reported by the simulator for the last
+	 * 		evaluation (empty if the simulator did not send one)
+	 */
+	const SimulationProfile &getProfile() const;
+
 	/**
 	 * @return evaluated_
 	 */
 	bool isEvaluated() const;
 
+	/**
+	 * @return true if the fitness comes from a reduced fidelity evaluation
+	 */
+	bool isLowFidelity() const;
+
 	/**
 	 * Makes robot be not evaluated again
 	 */
@@ -213,10 +242,24 @@ public:
 
 	/**
 	 * Set the fiteness and evaluated field when doing an asynchronous evaluation
+	 * (in the browser, which reports no objectives, so NSGA-II is rejected
+	 * there)
 	 * @param fitness the fitness to set
 	 */
 	void asyncEvaluateResult(double fitness);
 
+	/**
+	 * Set the fitness, profile and evaluated field when the evaluation was
+	 * run in-process rather than by a simulator server
+	 * @param fitness the fitness to set
+	 * @param objectives the objectives to set, may be empty
+	 * @param profile the simulation profile of the evaluation
+	 * @param lowFidelity whether the evaluation was at reduced fidelity
+	 */
+	void setEvaluationResult(double fitness,
+			const std::vector<double> &objectives,
+			const SimulationProfile &profile, bool lowFidelity);
+
 	/**
 	 * @return a string representation of the robot
 	 */
@@ -269,6 +312,16 @@ private:
 	 */
 	double fitness_;
 
+	/**
+	 * Objectives of robot, once evaluated, if the scenario provides them
+	 */
+	std::vector<double> objectives_;
+
+	/**
+	 * Simulation profile of the last evaluation
+	 */
+	SimulationProfile profile_;
+
 	/**
 	 * Counter for unique ID.
 	 */
@@ -279,6 +332,11 @@ private:
 	 */
 	bool evaluated_;
 
+	/**
+	 * Indicates whether the fitness comes from a reduced fidelity evaluation
+	 */
+	bool lowFidelity_;
+
 };
 
 /**
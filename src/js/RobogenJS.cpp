@@ -90,8 +90,7 @@ double EMSCRIPTEN_KEEPALIVE evaluate(int ptr, int length) {
 	// ---------------------------------------
 
 	boost::shared_ptr<RobogenConfig> configuration =
-	ConfigurationReader::parseRobogenMessage(
-			packet.getMessage()->configuration());
+	ConfigurationReader::parseEvaluationRequest(*packet.getMessage());
 	if (configuration == NULL) {
 		std::cerr
 		<< "Problems parsing the configuration file. Quit."
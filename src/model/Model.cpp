@@ -33,6 +33,7 @@
 #include <sstream>
 
 #include "CompositeBody.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -185,8 +186,8 @@ boost::shared_ptr<SimpleBody> Model::addBox(float mass,
 	dMassSetBoxTotal(&massOde, mass, lengthX, lengthY, lengthZ);
 	dxGeom* g = dCreateBox(this->getCollisionSpace(), lengthX, lengthY,
 							lengthZ);
-	boost::shared_ptr<SimpleBody> body(new SimpleBody(shared_from_this(),
-			massOde, g, pos));
+	boost::shared_ptr<SimpleBody> body = arenaShared<SimpleBody>(
+			shared_from_this(), massOde, g, pos);
 	this->addBody(body, label);
 	return body;
 }
@@ -205,8 +206,8 @@ boost::shared_ptr<SimpleBody> Model::addCylinder(float mass,
 		rotateCylinder.makeRotate(osg::inDegrees(90.0), osg::Vec3(1, 0, 0));
 	}
 
-	boost::shared_ptr<SimpleBody> body(new SimpleBody(shared_from_this(),
-				massOde, g, pos, rotateCylinder));
+	boost::shared_ptr<SimpleBody> body = arenaShared<SimpleBody>(
+			shared_from_this(), massOde, g, pos, rotateCylinder);
 	this->addBody(body, label);
 	return body;
 
@@ -228,14 +229,14 @@ boost::shared_ptr<SimpleBody> Model::addCapsule(float mass,
 		rotateCapsule.makeRotate(osg::inDegrees(90.0), osg::Vec3(1, 0, 0));
 	}
 
-	boost::shared_ptr<SimpleBody> body(new SimpleBody(shared_from_this(),
-					massOde, g, pos, rotateCapsule));
+	boost::shared_ptr<SimpleBody> body = arenaShared<SimpleBody>(
+			shared_from_this(), massOde, g, pos, rotateCapsule);
 	this->addBody(body, label);
 	return body;
 }
 
 void Model::fixBodies(std::vector<boost::shared_ptr<AbstractBody> > bodies) {
-	boost::shared_ptr<CompositeBody> composite(new CompositeBody());
+	boost::shared_ptr<CompositeBody> composite = arenaShared<CompositeBody>();
 	// shared_ptr is maintained on the child bodies
 	composite->init(bodies,this->getPhysicsWorld());
 }
@@ -251,7 +252,7 @@ void Model::fixBodies(boost::shared_ptr<SimpleBody> b1,
 
 
 #else
-	boost::shared_ptr<Joint> joint(new Joint());
+	boost::shared_ptr<Joint> joint = arenaShared<Joint>();
 	joint->createFixed(this->getPhysicsWorld(),b1, b2);
 	joints_.push_back(joint);
 #endif
@@ -261,7 +262,7 @@ void Model::fixBodies(boost::shared_ptr<SimpleBody> b1,
 boost::shared_ptr<Joint> Model::attachWithHinge(
 		boost::shared_ptr<SimpleBody> b1, boost::shared_ptr<SimpleBody> b2,
 		osg::Vec3 axis, osg::Vec3 anchor) {
-	boost::shared_ptr<Joint> joint(new Joint());
+	boost::shared_ptr<Joint> joint = arenaShared<Joint>();
 	joint->createHinge(this->getPhysicsWorld(), b1, b2, axis, anchor);
 	joints_.push_back(joint);
 	return joint;
@@ -270,7 +271,7 @@ boost::shared_ptr<Joint> Model::attachWithHinge(
 boost::shared_ptr<Joint> Model::attachWithUniversal(
 		boost::shared_ptr<SimpleBody> b1, boost::shared_ptr<SimpleBody> b2,
 		osg::Vec3 axis1, osg::Vec3 axis2, osg::Vec3 anchor) {
-	boost::shared_ptr<Joint> joint(new Joint());
+	boost::shared_ptr<Joint> joint = arenaShared<Joint>();
 	joint->createUniversal(this->getPhysicsWorld(), b1, b2, axis1, axis2,
 			anchor);
 	joints_.push_back(joint);
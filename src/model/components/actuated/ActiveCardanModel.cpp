@@ -28,6 +28,7 @@
  */
 #include "model/components/actuated/ActiveCardanModel.h"
 #include "model/motors/ServoMotor.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -155,14 +156,14 @@ bool ActiveCardanModel::initModel() {
 	this->fixBodies(crossPartB, crossPartBedge2);
 
 	// Create motors
-	motor1_.reset(
-			new ServoMotor(ioPair(this->getId(),0), joint,
+	motor1_ =
+			arenaShared<ServoMotor>(ioPair(this->getId(),0), joint,
 							ServoMotor::DEFAULT_MAX_FORCE_SERVO,
-							ServoMotor::DEFAULT_GAIN));
-	motor2_.reset(
-			new ServoMotor(ioPair(this->getId(),1), joint2,
+							ServoMotor::DEFAULT_GAIN);
+	motor2_ =
+			arenaShared<ServoMotor>(ioPair(this->getId(),1), joint2,
 							ServoMotor::DEFAULT_MAX_FORCE_SERVO,
-							ServoMotor::DEFAULT_GAIN));
+							ServoMotor::DEFAULT_GAIN);
 	return true;
 
 }
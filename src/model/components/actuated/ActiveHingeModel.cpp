@@ -28,6 +28,7 @@
  */
 #include "model/components/actuated/ActiveHingeModel.h"
 #include "model/motors/ServoMotor.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -99,10 +100,10 @@ bool ActiveHingeModel::initModel() {
 
 
 	// Create servo
-	this->motor_.reset(
-			new ServoMotor(ioPair(this->getId(),0), joint,
+	this->motor_ =
+			arenaShared<ServoMotor>(ioPair(this->getId(),0), joint,
 							ServoMotor::DEFAULT_MAX_FORCE_SERVO,
-							ServoMotor::DEFAULT_GAIN));
+							ServoMotor::DEFAULT_GAIN);
 
 
 	return true;
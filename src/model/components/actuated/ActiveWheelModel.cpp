@@ -28,6 +28,7 @@
  */
 #include "model/components/actuated/ActiveWheelModel.h"
 #include "model/motors/RotationMotor.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -95,9 +96,9 @@ bool ActiveWheelModel::initModel() {
 		   servo, wheel,  osg::Vec3(1, 0, 0), osg::Vec3(xWheel, 0, 0));
 
 	// Create servo
-	this->motor_.reset(
-		 new RotationMotor(ioPair(this->getId(),0), joint,
-				 RotationMotor::DEFAULT_MAX_FORCE_ROTATIONAL));
+	this->motor_ =
+		 arenaShared<RotationMotor>(ioPair(this->getId(),0), joint,
+				 RotationMotor::DEFAULT_MAX_FORCE_ROTATIONAL);
 
 	return true;
 
@@ -29,6 +29,7 @@
 #include <cmath>
 #include "model/components/actuated/ActiveWhegModel.h"
 #include "model/motors/RotationMotor.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -162,9 +163,9 @@ bool ActiveWhegModel::initModel() {
 		   osg::Vec3(1,0,0), osg::Vec3(xWheg, 0, 0));
 
    // Create servo
-   this->motor_.reset(
-   		 new RotationMotor(ioPair(this->getId(),0), joint,
-   				 RotationMotor::DEFAULT_MAX_FORCE_ROTATIONAL));
+   this->motor_ =
+   		 arenaShared<RotationMotor>(ioPair(this->getId(),0), joint,
+   				 RotationMotor::DEFAULT_MAX_FORCE_ROTATIONAL);
    return true;
 
 }
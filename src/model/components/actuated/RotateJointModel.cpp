@@ -28,6 +28,7 @@
  */
 #include "model/components/actuated/RotateJointModel.h"
 #include "model/motors/RotationMotor.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -85,9 +86,9 @@ bool RotateJointModel::initModel() {
 			osg::Vec3(1, 0, 0), osg::Vec3(xJointConnection, 0, 0));
 
 	// Create servo
-	this->motor_.reset(
-			 new RotationMotor(ioPair(this->getId(),0), joint,
-					 RotationMotor::DEFAULT_MAX_FORCE_ROTATIONAL));
+	this->motor_ =
+			 arenaShared<RotationMotor>(ioPair(this->getId(),0), joint,
+					 RotationMotor::DEFAULT_MAX_FORCE_ROTATIONAL);
 
 	return true;
 
@@ -27,6 +27,7 @@
  * @(#) $Id$
  */
 #include "model/components/perceptive/CoreComponentModel.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -44,7 +45,7 @@ CoreComponentModel::CoreComponentModel(dWorldID odeWorld, dSpaceID odeSpace,
 		hasSensors_(hasSensors) {
 
 	if (hasSensors) {
-		sensor_.reset(new ImuSensor(id + "-IMU"));
+		sensor_ = arenaShared<ImuSensor>(id + "-IMU");
 	}
 
 }
@@ -27,6 +27,7 @@
  */
 
 #include "model/components/perceptive/IrSensorModel.h"
+#include "utils/EvaluationArena.h"
 
 
 namespace robogen {
@@ -66,8 +67,8 @@ bool IrSensorModel::initModel() {
 
 	this->fixBodies(sensorRoot_, platform);
 
-	this->sensor_.reset(new IrSensor(this->getCollisionSpace(),
-			this->getBodies(), this->getId()));
+	this->sensor_ = arenaShared<IrSensor>(this->getCollisionSpace(),
+			this->getBodies(), this->getId());
 
 	return true;
 
@@ -27,6 +27,7 @@
  * @(#) $Id$
  */
 #include "model/components/perceptive/LightSensorModel.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -74,8 +75,8 @@ bool LightSensorModel::initModel() {
 
 	this->fixBodies(platform, cylinder);
 
-	this->sensor_.reset(new LightSensor(this->getCollisionSpace(),
-			this->getBodies(), this->getId()));
+	this->sensor_ = arenaShared<LightSensor>(this->getCollisionSpace(),
+			this->getBodies(), this->getId());
 
 	return true;
 
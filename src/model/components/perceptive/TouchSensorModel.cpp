@@ -28,6 +28,7 @@
  */
 #include "model/sensors/TouchSensor.h"
 #include "model/components/perceptive/TouchSensorModel.h"
+#include "utils/EvaluationArena.h"
 
 namespace robogen {
 
@@ -71,12 +72,12 @@ bool TouchSensorModel::initModel() {
 			SENSOR_WIDTH, SENSOR_HEIGHT, B_SENSOR_RIGHT);
 
 
-	this->sensorLeft_.reset(
-			new TouchSensor(this->getCollisionSpace(), leftSensor,
-					this->getId() + "-left"));
-	this->sensorRight_.reset(
-			new TouchSensor(this->getCollisionSpace(), rightSensor,
-					this->getId() + "-right"));
+	this->sensorLeft_ =
+			arenaShared<TouchSensor>(this->getCollisionSpace(), leftSensor,
+					this->getId() + "-left");
+	this->sensorRight_ =
+			arenaShared<TouchSensor>(this->getCollisionSpace(), rightSensor,
+					this->getId() + "-right");
 
 	// Connect everything
 	this->fixBodies(sensorRoot_, leftSensor);
@@ -0,0 +1,73 @@
+/*
+ * @(#) DirectionFlipCounter.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include "model/motors/DirectionFlipCounter.h"
+
+namespace robogen {
+
+DirectionFlipCounter::DirectionFlipCounter() : head_(0), size_(0),
+		flips_(0), lastDirection_(0), count_(0), window_(0) {
+}
+
+void DirectionFlipCounter::reset(unsigned int window) {
+	entries_.assign(window, Entry());
+	head_ = 0;
+	size_ = 0;
+	flips_ = 0;
+	lastDirection_ = 0;
+	count_ = 0;
+	window_ = window;
+}
+
+void DirectionFlipCounter::push(int direction) {
+	if (window_ == 0) {
+		return;
+	}
+
+	unsigned long long index = count_++;
+
+	// drop the direction leaving the window
+	if (size_ > 0 && entries_[head_].index + window_ <= index) {
+		flips_ -= entries_[head_].flipped;
+		head_ = (head_ + 1) % window_;
+		--size_;
+	}
+
+	if (direction == 0) {
+		return;
+	}
+
+	Entry &entry = entries_[(head_ + size_) % window_];
+	entry.index = index;
+	entry.direction = direction;
+	entry.flipped = (lastDirection_ * direction < 0) ? 1 : 0;
+	flips_ += entry.flipped;
+	++size_;
+	lastDirection_ = direction;
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * @(#) DirectionFlipCounter.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_DIRECTION_FLIP_COUNTER_H_
+#define ROBOGEN_DIRECTION_FLIP_COUNTER_H_
+
+#include <vector>
+
+namespace robogen {
+
+/**
+ * Counts the direction flips in a sliding window of the latest directions
+ * (-1, 0 or 1) given to a motor. Zero directions are ignored: a flip is a
+ * nonzero direction opposite to the previous nonzero one in the window.
+ *
+ * Each nonzero direction remembers whether it flipped with respect to the
+ * nonzero direction before it, so the count is the number of such flips in
+ * the window, minus the one of its oldest nonzero direction, whose
+ * predecessor is gone. Adding a direction and reading the count are O(1).
+ */
+class DirectionFlipCounter {
+
+public:
+
+	DirectionFlipCounter();
+
+	/**
+	 * Forget all directions and set the window size
+	 * @param window number of latest directions considered
+	 */
+	void reset(unsigned int window);
+
+	/**
+	 * Add the newest direction, dropping the oldest one if the window is full
+	 */
+	void push(int direction);
+
+	/**
+	 * @return number of flips in the window
+	 */
+	inline unsigned int getFlips() const {
+		if (size_ == 0) {
+			return 0;
+		}
+		return flips_ - entries_[head_].flipped;
+	}
+
+	inline unsigned int getWindow() const {
+		return window_;
+	}
+
+private:
+
+	struct Entry {
+		unsigned long long index;
+		int direction;
+		unsigned int flipped;
+	};
+
+	/**
+	 * Ring buffer of the nonzero directions in the window, oldest at head_
+	 */
+	std::vector<Entry> entries_;
+	unsigned int head_;
+	unsigned int size_;
+
+	/**
+	 * Number of entries flipped with respect to their predecessor
+	 */
+	unsigned int flips_;
+
+	/**
+	 * Latest nonzero direction, even if out of the window
+	 */
+	int lastDirection_;
+
+	/**
+	 * Number of directions pushed since the last reset
+	 */
+	unsigned long long count_;
+
+	unsigned int window_;
+};
+
+}
+
+#endif /* ROBOGEN_DIRECTION_FLIP_COUNTER_H_ */
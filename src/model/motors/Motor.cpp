@@ -27,6 +27,7 @@
  * @(#) $Id$
  */
 
+#include <cstring>
 #include <iostream>
 
 #include "model/motors/Motor.h"
@@ -35,9 +36,10 @@ namespace robogen{
 
 Motor::Motor(ioPair id, boost::shared_ptr<Joint> joint, float maxForce,
 		int maxDirectionShiftsPerSecond) : id_(id),
-		joint_(joint), internalCounter_(0), isBurntOut_(false),
-		maxForce_(maxForce),
-		maxDirectionShiftsPerSecond_(maxDirectionShiftsPerSecond) {
+		historySize_(0), numSignals_(0), previousSignal_(0),
+		joint_(joint), isBurntOut_(false),
+		maxDirectionShiftsPerSecond_(maxDirectionShiftsPerSecond),
+		maxForce_(maxForce) {
 
 	// need to set these on our joint object so that they get
 	// reset if the joint is reconnected
@@ -60,6 +62,15 @@ bool Motor::isBurntOut() {
 	return isBurntOut_;
 }
 
+void Motor::reset() {
+	isBurntOut_ = false;
+	historySize_ = 0;
+	numSignals_ = 0;
+	previousSignal_ = 0;
+	std::memset(&fback_, 0, sizeof(fback_));
+	dJointSetHingeParam(joint_->getJoint(), dParamVel, 0);
+}
+
 void Motor::setMaxDirectionShiftsPerSecond(int
 		maxDirectionShiftsPerSecond) {
 	maxDirectionShiftsPerSecond_ = maxDirectionShiftsPerSecond;
@@ -110,25 +121,35 @@ dReal Motor::getPosition() {
 
 void Motor::testBurnout(float stepSize) {
 	unsigned int historySize = ((unsigned int) (0.5/stepSize));
-	double signal = getSignal();
+	float signal = getSignal();
+	bool signalChange = (getDirectionSource() == SIGNAL_CHANGE);
+
+	if (historySize != historySize_) {
+		// first actuation, or the actuation period changed
+		historySize_ = historySize;
+		numSignals_ = 0;
+		// n signals have n - 1 changes
+		directionFlips_.reset((signalChange && historySize > 0) ?
+				historySize - 1 : historySize);
+	}
 
-	if(previousSignals_.size() < historySize) {
-		previousSignals_.push_back(signal);
-	} else {
-		previousSignals_[internalCounter_ % historySize] = signal;
+	if (!signalChange) {
+		directionFlips_.push(sgn(signal));
+	} else if (numSignals_ > 0) {
+		directionFlips_.push(sgn(signal - previousSignal_));
+	}
+	previousSignal_ = signal;
+	if (numSignals_ < historySize_) {
+		numSignals_++;
 	}
-	internalCounter_++;
 
-	if(previousSignals_.size() < 2)
+	if(numSignals_ < 2)
 		return;
 
-	int numDirectionFlips = getNumDirectionFlips();
+	int numDirectionFlips = directionFlips_.getFlips();
 	// considering previous half-second of simulated time
 	if ((numDirectionFlips * 2) > maxDirectionShiftsPerSecond_) {
 		std::cout << "motor burnt out!" << std::endl;
-		for(unsigned int i=0; i<previousSignals_.size(); i++) {
-			std::cout << previousSignals_[i] << std::endl;
-		}
 		isBurntOut_ = true;
 	}
 }
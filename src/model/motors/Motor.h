@@ -32,6 +32,7 @@
 
 #include "evolution/representation/NeuralNetworkRepresentation.h"
 #include "model/Joint.h"
+#include "model/motors/DirectionFlipCounter.h"
 
 namespace robogen {
 
@@ -81,6 +82,11 @@ public:
 	*/
 	virtual void step(float stepSize) = 0;
 
+	/**
+	 * Put the motor back in the state it was built in: not burnt out, no
+	 * control signal history, and no target velocity on its joint
+	 */
+	void reset();
 
 
 	/**
@@ -98,10 +104,25 @@ protected:
 	ioPair id_;
 
 	/**
-	 * Keep track of previous motor signals,
+	 * How the direction of the motor is derived from its control signals
+	 */
+	enum DirectionSource {
+		SIGNAL_SIGN,	// direction of the signal itself (velocity)
+		SIGNAL_CHANGE	// direction of its change (position)
+	};
+
+	/**
+	 * Direction flips over the previous half-second of control signals,
 	 * to be used for preventing burnout
 	 */
-	std::vector<float> previousSignals_;
+	DirectionFlipCounter directionFlips_;
+
+	/**
+	 * Number of control signals in the current burnout history
+	 */
+	unsigned int historySize_;
+	unsigned int numSignals_;
+	float previousSignal_;
 
 
 	template <typename T> int sgn(T val) {
@@ -126,15 +147,10 @@ protected:
 	 */
 	float maxForce_;
 
-	/**
-	 * Count number of time actuated
-	 */
-	unsigned int internalCounter_;
-
 	dJointFeedback  fback_;
 
 	virtual float getSignal() = 0;
-	virtual int getNumDirectionFlips() = 0;
+	virtual DirectionSource getDirectionSource() = 0;
 
 };
 
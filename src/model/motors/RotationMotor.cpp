@@ -89,19 +89,4 @@ void RotationMotor::step(float stepSize) {
 }
 
 
-int RotationMotor::getNumDirectionFlips() {
-	int numDirectionFlips = 0;
-	int previousSign = sgn(previousSignals_[0]);
-	for(unsigned int i=1; i<previousSignals_.size(); i++) {
-		int currentSign = sgn(previousSignals_[i]);
-		if (currentSign != 0) {
-			if (previousSign * currentSign < 0)
-				numDirectionFlips++;
-			previousSign = currentSign;
-		}
-	}
-	return numDirectionFlips;
-}
-
-
 }
@@ -82,7 +82,9 @@ public:
 
 	inline virtual float getSignal() { return desiredVelocity_; }
 
-	virtual int getNumDirectionFlips();
+	inline virtual DirectionSource getDirectionSource() {
+		return SIGNAL_SIGN;
+	}
 
 private:
 
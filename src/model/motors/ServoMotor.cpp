@@ -117,19 +117,4 @@ void ServoMotor::step(float stepSize) {
 
 }
 
-int ServoMotor::getNumDirectionFlips() {
-	int numDirectionFlips = 0;
-	int previousSign = sgn(previousSignals_[1] - previousSignals_[0]);
-	for(unsigned int i=2; i<previousSignals_.size(); i++) {
-		int currentSign = sgn(previousSignals_[i] - previousSignals_[i-1]);
-		if (currentSign != 0) {
-			if (previousSign * currentSign < 0)
-				numDirectionFlips++;
-			previousSign = currentSign;
-		}
-	}
-	return numDirectionFlips;
-}
-
-
 }
@@ -97,7 +97,9 @@ private:
 
 	inline virtual float getSignal() { return desiredPosition_; }
 
-	virtual int getNumDirectionFlips();
+	inline virtual DirectionSource getDirectionSource() {
+		return SIGNAL_CHANGE;
+	}
 };
 
 }
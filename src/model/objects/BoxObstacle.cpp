@@ -36,7 +36,7 @@ BoxObstacle::BoxObstacle(dWorldID odeWorld, dSpaceID odeSpace,
 		size_(size) {
 
 
-	if (density >= RobogenUtils::EPSILON_2){
+	if (!isStatic(density)){
 		// if not fixed, create body
 		box_ = dBodyCreate(odeWorld);
 		dMass massOde;
@@ -98,6 +98,28 @@ const osg::Quat BoxObstacle::getAttitude() {
 
 }
 
+bool BoxObstacle::isStatic() {
+	return box_ == 0;
+}
+
+bool BoxObstacle::isStatic(float density) {
+	return density < RobogenUtils::EPSILON_2;
+}
+
+void BoxObstacle::setPose(const osg::Vec3& position,
+		const osg::Quat& attitude) {
+	if (box_ == 0) {
+		return;
+	}
+	dBodySetPosition(box_, position.x(), position.y(), position.z());
+	dQuaternion boxQuat;
+	boxQuat[0] = attitude.w();
+	boxQuat[1] = attitude.x();
+	boxQuat[2] = attitude.y();
+	boxQuat[3] = attitude.z();
+	dBodySetQuaternion(box_, boxQuat);
+}
+
 const osg::Vec3 BoxObstacle::getSize() {
 	return size_;
 }
@@ -43,7 +43,9 @@ class BoxObstacle : public Obstacle {
 public:
 
 	/**
-	 * Initializes a box obstacle
+	 * Initializes a box obstacle.
+	 * Obstacles with (near) zero density are immovable: they get no body,
+	 * only a geom, so they should be placed in the environment's static space
 	 */
 	BoxObstacle(dWorldID odeWorld, dSpaceID odeSpace, const osg::Vec3& pos,
 			const osg::Vec3& size, float density,
@@ -65,6 +67,28 @@ public:
 	virtual const osg::Vec3 getPosition();
 	virtual const osg::Quat getAttitude();
 
+	/**
+	 * Inherited from Obstacle
+	 */
+	virtual bool isStatic();
+
+	/**
+	 * @return true if an obstacle of the given density is static
+	 */
+	static bool isStatic(float density);
+
+	/**
+	 * Moves a non-static box, used when replaying a recorded run
+	 */
+	void setPose(const osg::Vec3& position, const osg::Quat& attitude);
+
+	/**
+	 * @return the box body, 0 for a static box
+	 */
+	dBodyID getBody() {
+		return box_;
+	}
+
 	/**
 	 * @return the box size
 	 */
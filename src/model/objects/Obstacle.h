@@ -38,6 +38,15 @@ class Obstacle : public PositionObservable {
 	 */
 	virtual void remove() = 0;
 
+public:
+
+	/**
+	 * @return true if the obstacle can never move (it has no body)
+	 */
+	virtual bool isStatic() {
+		return false;
+	}
+
 };
 
 }
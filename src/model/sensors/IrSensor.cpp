@@ -73,6 +73,11 @@ struct RayTrace {
 };
 
 void IrSensor::collisionCallback(void *data, dGeomID o1, dGeomID o2){
+	// static geometry is kept in a sub-space, descend into it
+	if (dGeomIsSpace(o1) || dGeomIsSpace(o2)) {
+		dSpaceCollide2(o1, o2, data, &IrSensor::collisionCallback);
+		return;
+	}
 	RayTrace *r = (RayTrace*) data;
 	// ignore what needs ignoring
 	if (std::find(r->ignoreGeoms.begin(),r->ignoreGeoms.end(),
@@ -74,6 +74,12 @@ void TouchSensor::collisionCallback(void *data, dGeomID o1, dGeomID o2){
 	dContactGeom cont;
 	TouchData *touchData = ((TouchData*) data);
 
+	// static geometry is kept in a sub-space, descend into it
+	if (dGeomIsSpace(o1) || dGeomIsSpace(o2)) {
+		dSpaceCollide2(o1, o2, data, &TouchSensor::collisionCallback);
+		return;
+	}
+
 	// ignore collisions with any other geom that is part of this body
 	// this will be the paired touch sensor as well as the touch sensor base
 	dBodyID b = touchData->body->getBody();
@@ -25,7 +25,11 @@
  *
  * @(#) $Id$
  */
+#include <map>
+#include <boost/thread/mutex.hpp>
 #include "render/Mesh.h"
+#include <osg/Geode>
+#include <osg/Geometry>
 #include <osgDB/ReadFile>
 #include <osg/Version>
 #if OSG_VERSION_GREATER_OR_EQUAL(3, 2, 0)
@@ -34,7 +38,51 @@
 
 namespace robogen {
 
-Mesh::Mesh() {
+namespace {
+
+struct CachedMesh {
+	osg::ref_ptr<osg::Node> node;
+	osg::BoundingBox bb;
+};
+
+boost::mutex meshMutex;
+std::map<std::string, CachedMesh> meshes;
+
+/**
+ * Read and prepare a mesh file. The returned node is never modified
+ * afterwards, as it is shared by all the instances of the mesh.
+ */
+bool readMesh(const std::string& mesh, CachedMesh& cached) {
+
+	cached.node = osgDB::readNodeFile(mesh);
+	if (cached.node == NULL) {
+		return false;
+	}
+
+	cached.bb.expandBy(cached.node->getBound());
+
+#if OSG_VERSION_GREATER_OR_EQUAL(3, 2, 0)
+	osgUtil::SmoothingVisitor sv;
+	sv.setCreaseAngle(0);
+	cached.node->accept(sv);
+#endif
+
+	cached.node->setDataVariance(osg::Object::STATIC);
+	return true;
+}
+
+osg::Geometry* getGeometry(osg::Node* node) {
+#if OSG_VERSION_GREATER_OR_EQUAL(3, 2, 0)
+	return node->asGroup()->getChild(0)->asGeode()->getDrawable(0)
+			->asGeometry();
+#else
+	return node->asGeode()->getDrawable(0)->asGeometry();
+#endif
+}
+
+}
+
+Mesh::Mesh() : shared_(false) {
 
 }
 
@@ -44,38 +92,47 @@ Mesh::~Mesh() {
 
 bool Mesh::loadMesh(const std::string& mesh) {
 
-	meshNode_ = osgDB::readNodeFile(mesh);
-	if (meshNode_ == NULL) {
-		return false;
+	osg::BoundingBox bb;
+	{
+		// hold the lock while reading, so concurrent loads of the same file
+		// wait for the first one instead of all parsing it
+		boost::mutex::scoped_lock lock(meshMutex);
+
+		std::map<std::string, CachedMesh>::iterator it = meshes.find(mesh);
+		if (it == meshes.end()) {
+			CachedMesh cached;
+			if (!readMesh(mesh, cached)) {
+				return false;
+			}
+			it = meshes.insert(std::make_pair(mesh, cached)).first;
+		}
+		meshNode_ = it->second.node;
+		bb = it->second.bb;
 	}
+	shared_ = true;
 
 	// Translate mesh to center
-	osg::BoundingBox bb;
-	bb.expandBy(meshNode_->getBound());
-
 	meshPat_ = new osg::PositionAttitudeTransform();
 
-	osg::PositionAttitudeTransform* shiftToCenterPat =
-			new osg::PositionAttitudeTransform();
-	shiftToCenterPat->setPosition(-bb.center());
-	shiftToCenterPat->addChild(meshNode_);
+	centerPat_ = new osg::PositionAttitudeTransform();
+	centerPat_->setPosition(-bb.center());
+	centerPat_->addChild(meshNode_);
 
-	meshPat_->addChild(shiftToCenterPat);
+	meshPat_->addChild(centerPat_);
 
 	xLen_ = bb.xMax() - bb.xMin();
 	yLen_ = bb.yMax() - bb.yMin();
 	zLen_ = bb.zMax() - bb.zMin();
 
-#if OSG_VERSION_GREATER_OR_EQUAL(3, 2, 0)
-	osgUtil::SmoothingVisitor sv;
-	sv.setCreaseAngle(0);
-	meshNode_->accept(sv);
-#endif
-
 	return true;
 
 }
 
+void Mesh::clearCache() {
+	boost::mutex::scoped_lock lock(meshMutex);
+	meshes.clear();
+}
+
 void Mesh::rescaleMesh(float scaleX, float scaleY, float scaleZ) {
 	osg::PositionAttitudeTransform* rescalePat =
 			new osg::PositionAttitudeTransform();
@@ -100,16 +157,24 @@ float Mesh::zLen() {
 }
 
 void Mesh::setColor(osg::Vec4 color) {
+	if (shared_) {
+		// copy the nodes and drawables only: vertices, normals and
+		// primitives stay shared with the cached mesh
+		osg::ref_ptr<osg::Node> copy = static_cast<osg::Node*>(
+				meshNode_->clone(osg::CopyOp::DEEP_COPY_NODES |
+						osg::CopyOp::DEEP_COPY_DRAWABLES));
+		centerPat_->replaceChild(meshNode_, copy);
+		meshNode_ = copy;
+		shared_ = false;
+	}
+
+	osg::Geometry* geometry = getGeometry(meshNode_);
 #if OSG_VERSION_GREATER_OR_EQUAL(3, 2, 0)
-	osg::Geometry* geometry =
-	 meshNode_->asGroup()->getChild(0)->asGeode()->getDrawable(0)->asGeometry();
 	osg::Vec4Array* colors = new osg::Vec4Array;
 	colors->push_back(color);
 	colors->setBinding(osg::Array::BIND_OVERALL);
 	geometry->setColorArray(colors);
 #else
-	osg::Geometry* geometry =
-			this->meshNode_->asGeode()->getDrawable(0)->asGeometry();
 	osg::Vec4Array* colors = new osg::Vec4Array;
 	colors->push_back(color);
 	geometry->setColorArray(colors);
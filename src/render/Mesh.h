@@ -33,6 +33,12 @@
 
 namespace robogen {
 
+/**
+ * A mesh instance. The geometry read from a mesh file is shared by all the
+ * instances of that file in the process: it is read only once, and each
+ * instance only adds its own transforms (and, once colored, its own copy of
+ * the drawables, still sharing the vertex, normal and index arrays).
+ */
 class Mesh {
 
 public:
@@ -41,6 +47,12 @@ public:
 
 	virtual ~Mesh();
 
+	/**
+	 * Load a mesh, reading the file only the first time it is requested in
+	 * this process
+	 * @param mesh path of the mesh file
+	 * @return true if the mesh could be loaded
+	 */
 	bool loadMesh(const std::string& mesh);
 	void rescaleMesh(float scaleX, float scaleY, float scaleZ);
 
@@ -50,12 +62,30 @@ public:
 	float yLen();
 	float zLen();
 
+	/**
+	 * Color this instance only, leaving the shared geometry untouched
+	 */
 	void setColor(osg::Vec4 color);
 
+	/**
+	 * Drop the cached meshes. Instances already loaded keep their geometry.
+	 */
+	static void clearCache();
+
 private:
 
 	osg::ref_ptr<osg::Node> meshNode_;
 
+	/**
+	 * Transform holding meshNode_, centering it
+	 */
+	osg::ref_ptr<osg::PositionAttitudeTransform> centerPat_;
+
+	/**
+	 * Whether meshNode_ is still the cached node, shared with other instances
+	 */
+	bool shared_;
+
 	osg::ref_ptr<osg::PositionAttitudeTransform> meshPat_;
 
 	float xLen_;
@@ -64,8 +64,9 @@ TerrainRender::TerrainRender(boost::shared_ptr<Terrain> terrain) {
 
 		// 1) Load the height field
 
-		unsigned int xPointsCount = terrain->getHeightFieldData()->s();
-		unsigned int yPointsCount = terrain->getHeightFieldData()->t();
+		boost::shared_ptr<const HeightMap> heightMap = terrain->getHeightMap();
+		unsigned int xPointsCount = heightMap->getNumCols();
+		unsigned int yPointsCount = heightMap->getNumRows();
 
 		osg::ref_ptr<osg::HeightField> heightField(new osg::HeightField);
 		heightField->allocate(xPointsCount, yPointsCount);
@@ -78,8 +79,7 @@ TerrainRender::TerrainRender(boost::shared_ptr<Terrain> terrain) {
 		// Copy height information to the glfloat array
 		for (unsigned int i = 0; i < xPointsCount; ++i) {
 			for (unsigned int j = 0; j < yPointsCount; ++j) {
-				heightField->setHeight(i, j,
-						((*terrain->getHeightFieldData()->data(i, j)) / 255.0)
+				heightField->setHeight(i, j, heightMap->getSample(i, j)
 								* fromOde(terrain->getHeightFieldHeight()));
 			}
 		}
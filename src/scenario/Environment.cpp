@@ -33,7 +33,7 @@ namespace robogen {
 
 Environment::Environment(dWorldID odeWorld, dSpaceID odeSpace,
 		boost::shared_ptr<RobogenConfig> robogenConfig) :
-				odeWorld_(odeWorld), odeSpace_(odeSpace),
+				odeWorld_(odeWorld), odeSpace_(odeSpace), staticSpace_(0),
 				robogenConfig_(robogenConfig),
 				timeElapsed_(0),
 				ambientLight_(DEFAULT_AMBIENT_LIGHT) {
@@ -42,6 +42,8 @@ Environment::Environment(dWorldID odeWorld, dSpaceID odeSpace,
 Environment::~Environment() {
 	odeWorld_ = 0;
 	odeSpace_ = 0;
+	// staticSpace_ is destroyed along with odeSpace_
+	staticSpace_ = 0;
 	terrain_.reset();
 	obstacles_.clear();
 }
@@ -51,8 +53,11 @@ bool Environment::init() {
 	boost::shared_ptr<TerrainConfig> terrainConfig =
 			robogenConfig_->getTerrainConfig();
 
+	// Static geometry goes in its own space inside the main one
+	staticSpace_ = dHashSpaceCreate(odeSpace_);
+
 	terrain_ = boost::shared_ptr<Terrain>(
-			new Terrain(odeWorld_, odeSpace_));
+			new Terrain(odeWorld_, staticSpace_));
 	if (terrainConfig->getType() == TerrainConfig::FLAT) {
 		if(!terrain_->initFlat(terrainConfig->getLength(),
 				terrainConfig->getWidth())) {
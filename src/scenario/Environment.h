@@ -87,6 +87,16 @@ public:
 		return terrain_;
 	}
 
+	/**
+	 * @return the space holding all immovable geometry (terrain and static
+	 * 		obstacles). It is a child of the main space, so the collision
+	 * 		callback only ever collides it against the other geoms with
+	 * 		dSpaceCollide2, never static geoms against each other.
+	 */
+	dSpaceID getStaticSpace() {
+		return staticSpace_;
+	}
+
 	std::vector<boost::shared_ptr<Obstacle> > getObstacles() {
 		return obstacles_;
 	}
@@ -102,6 +112,11 @@ private:
 	 */
 	dSpaceID odeSpace_;
 
+	/**
+	 * ODE collision space for static geometry, owned by odeSpace_
+	 */
+	dSpaceID staticSpace_;
+
 	/**
 	 * Robogen config
 	 */
@@ -0,0 +1,179 @@
+/*
+ * @(#) HeightMap.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#ifndef DISABLE_HEIGHT_MAP
+
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/thread/mutex.hpp>
+#include <osg/Image>
+#include <osgDB/ReadFile>
+#include "scenario/HeightMap.h"
+
+namespace robogen {
+
+namespace {
+
+const char RAW_MAGIC[4] = {'R', 'H', 'M', 'P'};
+const boost::uint32_t RAW_VERSION = 1;
+const size_t RAW_HEADER_SIZE = 4 + 4 * sizeof(boost::uint32_t);
+
+boost::mutex heightMapMutex;
+std::map<std::string, boost::shared_ptr<const HeightMap> > heightMaps;
+
+}
+
+HeightMap::HeightMap() : cols_(0), rows_(0), sampleType_(BYTE_SAMPLES),
+		data_(NULL) {
+}
+
+boost::shared_ptr<const HeightMap> HeightMap::load(
+		const std::string& fileName) {
+
+	// hold the lock while loading, so concurrent trials wait for the first
+	// one instead of all reading the same file
+	boost::mutex::scoped_lock lock(heightMapMutex);
+
+	std::map<std::string, boost::shared_ptr<const HeightMap> >::iterator it =
+			heightMaps.find(fileName);
+	if (it != heightMaps.end()) {
+		return it->second;
+	}
+
+	boost::shared_ptr<const HeightMap> heightMap;
+	if (boost::filesystem::path(fileName).extension().string().compare(
+			".hmap") == 0) {
+		heightMap = loadRaw(fileName);
+	} else {
+		heightMap = loadImage(fileName);
+	}
+
+	if (heightMap) {
+		if (heightMap->cols_ < 2 || heightMap->rows_ < 2) {
+			std::cerr << "The height map '" << fileName << "' needs at least "
+					<< "2x2 samples." << std::endl;
+			return boost::shared_ptr<const HeightMap>();
+		}
+		heightMaps[fileName] = heightMap;
+	}
+	return heightMap;
+}
+
+boost::shared_ptr<const HeightMap> HeightMap::loadRaw(
+		const std::string& fileName) {
+
+	boost::shared_ptr<HeightMap> heightMap(new HeightMap());
+	try {
+		boost::interprocess::file_mapping file(fileName.c_str(),
+				boost::interprocess::read_only);
+		heightMap->region_.reset(new boost::interprocess::mapped_region(file,
+				boost::interprocess::read_only));
+	} catch (boost::interprocess::interprocess_exception &e) {
+		std::cerr << "Cannot map the height map file '" << fileName << "': "
+				<< e.what() << std::endl;
+		return boost::shared_ptr<const HeightMap>();
+	}
+
+	const char *bytes =
+			static_cast<const char*>(heightMap->region_->get_address());
+	size_t size = heightMap->region_->get_size();
+
+	boost::uint32_t header[4];
+	if (size < RAW_HEADER_SIZE ||
+			std::memcmp(bytes, RAW_MAGIC, sizeof(RAW_MAGIC)) != 0) {
+		std::cerr << "'" << fileName << "' is not a raw height map."
+				<< std::endl;
+		return boost::shared_ptr<const HeightMap>();
+	}
+	std::memcpy(header, bytes + sizeof(RAW_MAGIC), sizeof(header));
+
+	if (header[0] != RAW_VERSION) {
+		std::cerr << "Unsupported version " << header[0] << " of raw height "
+				<< "map '" << fileName << "'." << std::endl;
+		return boost::shared_ptr<const HeightMap>();
+	}
+	if (header[3] != BYTE_SAMPLES && header[3] != FLOAT_SAMPLES) {
+		std::cerr << "Unknown sample type " << header[3] << " in raw height "
+				<< "map '" << fileName << "'." << std::endl;
+		return boost::shared_ptr<const HeightMap>();
+	}
+
+	heightMap->cols_ = header[1];
+	heightMap->rows_ = header[2];
+	heightMap->sampleType_ = static_cast<SampleType>(header[3]);
+
+	size_t sampleSize = (heightMap->sampleType_ == BYTE_SAMPLES) ?
+			sizeof(unsigned char) : sizeof(float);
+	if (size < RAW_HEADER_SIZE + static_cast<size_t>(heightMap->cols_) *
+			heightMap->rows_ * sampleSize) {
+		std::cerr << "The raw height map '" << fileName << "' is truncated."
+				<< std::endl;
+		return boost::shared_ptr<const HeightMap>();
+	}
+	// header is 20 bytes, so float samples stay 4 byte aligned
+	heightMap->data_ = bytes + RAW_HEADER_SIZE;
+
+	return heightMap;
+}
+
+boost::shared_ptr<const HeightMap> HeightMap::loadImage(
+		const std::string& fileName) {
+
+	osg::ref_ptr<osg::Image> image = osgDB::readImageFile(fileName);
+	if (image == NULL) {
+		std::cerr << "Cannot load the height map file '" << fileName
+				<< "'." << std::endl;
+		return boost::shared_ptr<const HeightMap>();
+	}
+
+	boost::shared_ptr<HeightMap> heightMap(new HeightMap());
+	heightMap->cols_ = image->s();
+	heightMap->rows_ = image->t();
+	heightMap->sampleType_ = BYTE_SAMPLES;
+
+	// image row t is at y index t, we store rows starting from maximum y
+	heightMap->bytes_.resize(heightMap->cols_ * heightMap->rows_);
+	for (unsigned int y = 0; y < heightMap->rows_; ++y) {
+		unsigned int row = heightMap->rows_ - 1 - y;
+		for (unsigned int x = 0; x < heightMap->cols_; ++x) {
+			heightMap->bytes_[row * heightMap->cols_ + x] = *image->data(x, y);
+		}
+	}
+	heightMap->data_ = &heightMap->bytes_[0];
+
+	return heightMap;
+}
+
+}
+
+#endif /* DISABLE_HEIGHT_MAP */
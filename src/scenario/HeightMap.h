@@ -0,0 +1,148 @@
+/*
+ * @(#) HeightMap.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_HEIGHT_MAP_H_
+#define ROBOGEN_HEIGHT_MAP_H_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace boost {
+namespace interprocess {
+class mapped_region;
+}
+}
+
+namespace robogen {
+
+/**
+ * Immutable terrain elevation samples, normalized to [0, 1].
+ *
+ * Height maps are loaded once per process (see load()) and then shared
+ * read-only by all trials and threads that use the same file, ODE reads the
+ * samples directly without copying them.
+ *
+ * Samples are stored row by row, starting from the row at the maximum y
+ * (the top of the map when viewed from above), which is the layout expected
+ * by dGeomHeightfield once rotated to be z-up.
+ *
+ * Two file formats are accepted:
+ * - any image osgDB can read (8 bit, first channel used)
+ * - raw height maps (extension .hmap), which are memory mapped:
+ *		char[4]		magic "RHMP"
+ *		uint32		format version (1)
+ *		uint32		number of columns (samples along x)
+ *		uint32		number of rows (samples along y)
+ *		uint32		sample type (0: uint8 in [0, 255], 1: float32 in [0, 1])
+ *		samples		columns * rows samples, row by row as above
+ * all fields in native (little endian) byte order.
+ */
+class HeightMap : private boost::noncopyable {
+
+public:
+
+	enum SampleType {
+		BYTE_SAMPLES = 0,
+		FLOAT_SAMPLES = 1
+	};
+
+	/**
+	 * Get the height map stored in the given file, loading it only the first
+	 * time it is requested in this process
+	 * @param fileName
+	 * @return the height map, or an empty pointer if it could not be loaded
+	 */
+	static boost::shared_ptr<const HeightMap> load(const std::string& fileName);
+
+	/**
+	 * @return number of samples along x
+	 */
+	unsigned int getNumCols() const {
+		return cols_;
+	}
+
+	/**
+	 * @return number of samples along y
+	 */
+	unsigned int getNumRows() const {
+		return rows_;
+	}
+
+	SampleType getSampleType() const {
+		return sampleType_;
+	}
+
+	/**
+	 * @return the raw samples, in the layout described above
+	 */
+	const void *getData() const {
+		return data_;
+	}
+
+	/**
+	 * @param x sample index along x
+	 * @param y sample index along y (0 is the minimum y)
+	 * @return the normalized elevation at the given sample
+	 */
+	float getSample(unsigned int x, unsigned int y) const {
+		size_t index = (rows_ - 1 - y) * cols_ + x;
+		if (sampleType_ == BYTE_SAMPLES) {
+			return static_cast<const unsigned char*>(data_)[index] / 255.0f;
+		}
+		return static_cast<const float*>(data_)[index];
+	}
+
+private:
+
+	HeightMap();
+
+	static boost::shared_ptr<const HeightMap> loadRaw(
+			const std::string& fileName);
+
+	static boost::shared_ptr<const HeightMap> loadImage(
+			const std::string& fileName);
+
+	unsigned int cols_;
+	unsigned int rows_;
+	SampleType sampleType_;
+
+	/**
+	 * Points either to bytes_ or into region_
+	 */
+	const void *data_;
+
+	std::vector<unsigned char> bytes_;
+
+	boost::shared_ptr<boost::interprocess::mapped_region> region_;
+
+};
+
+}
+
+#endif /* ROBOGEN_HEIGHT_MAP_H_ */
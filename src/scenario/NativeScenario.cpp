@@ -0,0 +1,226 @@
+/*
+ * @(#) NativeScenario.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#ifndef EMSCRIPTEN
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <boost/thread/mutex.hpp>
+#include "config/RobogenConfig.h"
+#include "scenario/NativeScenario.h"
+#include "scenario/ScenarioPlugin.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace robogen {
+
+namespace {
+
+/**
+ * Entry points of a loaded plugin
+ */
+struct ScenarioPluginLibrary {
+	RobogenScenarioPluginCreateFunction create;
+	RobogenScenarioPluginDestroyFunction destroy;
+};
+
+/**
+ * Deleter handing the scenario back to the plugin that created it
+ */
+struct ScenarioPluginDeleter {
+	ScenarioPluginDeleter(RobogenScenarioPluginDestroyFunction destroy) :
+		destroy_(destroy) {
+	}
+	void operator()(Scenario *scenario) {
+		destroy_(scenario);
+	}
+	RobogenScenarioPluginDestroyFunction destroy_;
+};
+
+boost::mutex pluginMutex;
+std::map<std::string, ScenarioPluginLibrary> loadedPlugins;
+
+/**
+ * Plugins that could not be loaded, so that they are neither opened nor
+ * reported again for every evaluation
+ */
+std::set<std::string> failedPlugins;
+
+#ifdef WIN32
+typedef HMODULE LibraryHandle;
+
+LibraryHandle openLibrary(const std::string &path) {
+	return LoadLibraryA(path.c_str());
+}
+
+void *getSymbol(LibraryHandle handle, const char *name) {
+	return (void *) GetProcAddress(handle, name);
+}
+
+void closeLibrary(LibraryHandle handle) {
+	FreeLibrary(handle);
+}
+
+std::string lastLibraryError() {
+	std::stringstream ss;
+	ss << "error code " << GetLastError();
+	return ss.str();
+}
+#else
+typedef void* LibraryHandle;
+
+LibraryHandle openLibrary(const std::string &path) {
+	return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+}
+
+void *getSymbol(LibraryHandle handle, const char *name) {
+	return dlsym(handle, name);
+}
+
+void closeLibrary(LibraryHandle handle) {
+	dlclose(handle);
+}
+
+std::string lastLibraryError() {
+	const char *error = dlerror();
+	return error ? std::string(error) : std::string("unknown error");
+}
+#endif
+
+/**
+ * Check the interface version of an opened plugin and find its entry points
+ * @return false if the plugin can not be used
+ */
+bool getEntryPoints(const std::string &path, LibraryHandle handle,
+		ScenarioPluginLibrary &library) {
+
+	RobogenScenarioPluginVersionFunction version =
+			(RobogenScenarioPluginVersionFunction) getSymbol(handle,
+					ROBOGEN_SCENARIO_PLUGIN_VERSION_SYMBOL);
+	if (!version) {
+		std::cerr << "Scenario plugin '" << path << "' does not export "
+				<< ROBOGEN_SCENARIO_PLUGIN_VERSION_SYMBOL
+				<< ", was it built with ROBOGEN_SCENARIO_PLUGIN?" << std::endl;
+		return false;
+	}
+	if (version() != ROBOGEN_SCENARIO_PLUGIN_ABI_VERSION) {
+		std::cerr << "Scenario plugin '" << path << "' was built for plugin "
+				<< "interface version " << version() << ", but this simulator "
+				<< "requires version " << ROBOGEN_SCENARIO_PLUGIN_ABI_VERSION
+				<< ". Please rebuild the plugin." << std::endl;
+		return false;
+	}
+
+	library.create = (RobogenScenarioPluginCreateFunction) getSymbol(handle,
+			ROBOGEN_SCENARIO_PLUGIN_CREATE_SYMBOL);
+	library.destroy = (RobogenScenarioPluginDestroyFunction) getSymbol(handle,
+			ROBOGEN_SCENARIO_PLUGIN_DESTROY_SYMBOL);
+	if (!library.create || !library.destroy) {
+		std::cerr << "Scenario plugin '" << path << "' is missing "
+				<< ROBOGEN_SCENARIO_PLUGIN_CREATE_SYMBOL << " or "
+				<< ROBOGEN_SCENARIO_PLUGIN_DESTROY_SYMBOL << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool loadPlugin(const std::string &path, ScenarioPluginLibrary &library) {
+
+	boost::mutex::scoped_lock lock(pluginMutex);
+
+	std::map<std::string, ScenarioPluginLibrary>::iterator it =
+			loadedPlugins.find(path);
+	if (it != loadedPlugins.end()) {
+		library = it->second;
+		return true;
+	}
+	if (failedPlugins.count(path)) {
+		return false;
+	}
+
+	LibraryHandle handle = openLibrary(path);
+	if (!handle) {
+		std::cerr << "Cannot load scenario plugin '" << path << "': "
+				<< lastLibraryError() << std::endl;
+		failedPlugins.insert(path);
+		return false;
+	}
+
+	if (!getEntryPoints(path, handle, library)) {
+		closeLibrary(handle);
+		failedPlugins.insert(path);
+		return false;
+	}
+
+	// handle is intentionally never closed, scenarios may outlive any caller
+	loadedPlugins[path] = library;
+	return true;
+}
+
+}
+
+bool NativeScenario::isNativeScenario(const std::string &scenario) {
+	if (scenario.find('\n') != std::string::npos) {
+		// script content, not a path
+		return false;
+	}
+	std::string extension =
+			boost::filesystem::path(scenario).extension().string();
+	return extension.compare(".so") == 0 ||
+			extension.compare(".dylib") == 0 ||
+			extension.compare(".dll") == 0;
+}
+
+boost::shared_ptr<Scenario> NativeScenario::createScenario(
+		boost::shared_ptr<RobogenConfig> config) {
+
+	ScenarioPluginLibrary library;
+	if (!loadPlugin(config->getScenario(), library)) {
+		return boost::shared_ptr<Scenario>();
+	}
+
+	Scenario *scenario = library.create(&config);
+	if (scenario == NULL) {
+		std::cerr << "Scenario plugin '" << config->getScenario()
+				<< "' failed to create a scenario" << std::endl;
+		return boost::shared_ptr<Scenario>();
+	}
+	return boost::shared_ptr<Scenario>(scenario,
+			ScenarioPluginDeleter(library.destroy));
+}
+
+}
+
+#endif /* EMSCRIPTEN */
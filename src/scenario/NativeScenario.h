@@ -0,0 +1,82 @@
+/*
+ * @(#) NativeScenario.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_NATIVE_SCENARIO_H_
+#define ROBOGEN_NATIVE_SCENARIO_H_
+
+#ifndef EMSCRIPTEN
+
+#include <string>
+#include <boost/shared_ptr.hpp>
+#include "Robogen.h"
+
+namespace robogen {
+
+class Scenario;
+class RobogenConfig;
+
+/**
+ * Loads scenarios compiled as shared libraries (see ScenarioPlugin.h).
+ * Plugins implement the Scenario virtuals directly in C++, so they avoid the
+ * per step cost of calling into the script engine.
+ *
+ * Libraries are opened once and stay loaded for the life of the process, so
+ * that the many evaluations a server performs do not pay for dlopen again.
+ */
+class NativeScenario {
+
+public:
+
+	/**
+	 * @param scenario the scenario parameter of a RobogenConfig
+	 * @return true if the scenario refers to a compiled plugin
+	 */
+	static bool isNativeScenario(const std::string &scenario);
+
+	/**
+	 * Instantiate the scenario provided by the plugin at config->getScenario()
+	 * @param config
+	 * @return the scenario, or an empty pointer if the plugin could not be
+	 * 		loaded
+	 */
+	static boost::shared_ptr<Scenario> createScenario(
+			boost::shared_ptr<RobogenConfig> config);
+
+private:
+
+	/**
+	 * Disable instantiation
+	 */
+	NativeScenario();
+
+};
+
+}
+
+#endif /* EMSCRIPTEN */
+
+#endif /* ROBOGEN_NATIVE_SCENARIO_H_ */
@@ -45,7 +45,8 @@
 namespace robogen {
 
 QScriptScenario::QScriptScenario(boost::shared_ptr<RobogenConfig> config) :
-	Scenario(config), engine_(new QScriptEngine), curTrial_(0) {
+	Scenario(config), engine_(new QScriptEngine), curTrial_(0),
+	callbackInterval_(1), stepCount_(0), recordSamples_(false) {
 
 	engine_->globalObject().setProperty("qScriptScenario",
 			engine_->newQObject(this));
@@ -121,8 +122,8 @@ QScriptScenario::QScriptScenario(boost::shared_ptr<RobogenConfig> config) :
 	// now check all (include getFitness, so user does not get confused
 	// 				  by its omission)
 	std::string methods[] = {"setupSimulation", "afterSimulationStep",
-								"endSimulation", "getFitness" };
-	size_t numMethods = 4;
+								"endSimulation", "getFitness", "getObjectives" };
+	size_t numMethods = 5;
 
 	for(size_t i = 0; i < numMethods; ++i) {
 		implementedMethods_[methods[i]] = isValidFunction(methods[i]);
@@ -132,6 +133,20 @@ QScriptScenario::QScriptScenario(boost::shared_ptr<RobogenConfig> config) :
 		}
 	}
 
+	// optional properties controlling how often the script is called
+	QScriptValue callbackInterval = userScenario_.property("callbackInterval");
+	if (callbackInterval.isValid() && !callbackInterval.isUndefined()) {
+		if (!callbackInterval.isNumber() || callbackInterval.toInt32() < 1) {
+			std::cerr << "The scenario's callbackInterval must be a positive "
+					<< "number of steps!" << std::endl;
+			exitRobogen(EXIT_FAILURE);
+		}
+		callbackInterval_ = callbackInterval.toUInt32();
+		std::cout << "Calling afterSimulationStep every " << callbackInterval_
+				<< " steps" << std::endl;
+	}
+	recordSamples_ = userScenario_.property("recordSamples").toBool();
+
 
 }
 
@@ -149,6 +164,11 @@ bool QScriptScenario::setupSimulation() {
 			new qscript::QEnvironment(Scenario::getEnvironment()),
 			QScriptEngine::ScriptOwnership);
 
+	stepCount_ = 0;
+	if (recordSamples_) {
+		sampler_.reset(Scenario::getRobot());
+	}
+
 	if(implementedMethods_["setupSimulation"]) {
 		QScriptValue function = userScenario_.property("setupSimulation");
 		QScriptValue resultValue = function.call(userScenario_);
@@ -165,9 +185,21 @@ bool QScriptScenario::setupSimulation() {
 }
 
 bool QScriptScenario::afterSimulationStep() {
+	if (recordSamples_) {
+		sampler_.record();
+	}
+	stepCount_++;
+	if (stepCount_ % callbackInterval_ != 0) {
+		return true;
+	}
+
 	if(implementedMethods_["afterSimulationStep"]) {
+		QScriptValueList args;
+		if (recordSamples_) {
+			args << sampler_.flush(engine_.get());
+		}
 		QScriptValue function = userScenario_.property("afterSimulationStep");
-		QScriptValue resultValue = function.call(userScenario_);
+		QScriptValue resultValue = function.call(userScenario_, args);
 		if(engine_->hasUncaughtException()) {
 			std::cerr << resultValue.toString().toStdString() << std::endl;
 			return false;
@@ -181,8 +213,13 @@ bool QScriptScenario::afterSimulationStep() {
 bool QScriptScenario::endSimulation() {
 	bool result = true;
 	if(implementedMethods_["endSimulation"]) {
+		// hand over whatever was recorded since the last callback
+		QScriptValueList args;
+		if (recordSamples_) {
+			args << sampler_.flush(engine_.get());
+		}
 		QScriptValue function = userScenario_.property("endSimulation");
-		QScriptValue resultValue = function.call(userScenario_);
+		QScriptValue resultValue = function.call(userScenario_, args);
 		if(engine_->hasUncaughtException()) {
 			std::cerr << resultValue.toString().toStdString() << std::endl;
 			result = false;
@@ -219,6 +256,29 @@ double QScriptScenario::getFitness() {
 	}
 }
 
+std::vector<double> QScriptScenario::getObjectives() {
+	std::vector<double> objectives;
+	if(!implementedMethods_["getObjectives"]) {
+		return objectives;
+	}
+	QScriptValue function = userScenario_.property("getObjectives");
+	QScriptValue resultValue = function.call(userScenario_);
+	if(engine_->hasUncaughtException()) {
+		std::cerr << resultValue.toString().toStdString() << std::endl;
+		return objectives;
+	}
+	if(!resultValue.isArray()) {
+		std::cerr << "The scenario's getObjectives must return an array of "
+				<< "numbers!" << std::endl;
+		return objectives;
+	}
+	unsigned int length = resultValue.property("length").toUInt32();
+	for(unsigned int i = 0; i < length; ++i) {
+		objectives.push_back(resultValue.property(i).toNumber());
+	}
+	return objectives;
+}
+
 bool QScriptScenario::isValidFunction(std::string name) {
 	QScriptValue function = userScenario_.property(name.c_str());
 	return function.isValid();
@@ -65,6 +65,7 @@ public:
 	virtual bool afterSimulationStep();
 	virtual bool endSimulation();
 	virtual double getFitness();
+	virtual std::vector<double> getObjectives();
 	virtual bool remainingTrials();
 
 
@@ -91,6 +92,20 @@ private:
 
 	bool initSuccess_;
 
+	/**
+	 * afterSimulationStep is only called into every callbackInterval_ steps
+	 * (set by the script's callbackInterval property, default 1)
+	 */
+	unsigned int callbackInterval_;
+	unsigned int stepCount_;
+
+	/**
+	 * If the script sets recordSamples, samples of every step are passed
+	 * in batches to afterSimulationStep and endSimulation
+	 */
+	bool recordSamples_;
+	qscript::StepSampler sampler_;
+
 };
 
 }
@@ -110,8 +110,11 @@ bool Scenario::init(dWorldID odeWorld, dSpaceID odeSpace,
 	double overlapMaxZ=minZ;
 
 	for (unsigned int i = 0; i < obstacleCoordinates.size(); ++i) {
+		// immovable obstacles are only collided against the rest of the world
+		dSpaceID obstacleSpace = BoxObstacle::isStatic(d[i]) ?
+				environment_->getStaticSpace() : odeSpace;
 		boost::shared_ptr<BoxObstacle> obstacle(
-									new BoxObstacle(odeWorld, odeSpace,
+									new BoxObstacle(odeWorld, obstacleSpace,
 											obstacleCoordinates[i],
 											obstacleSizes[i], d[i], rotationAxis[i],
 											rotationAngles[i]));
@@ -263,5 +266,9 @@ boost::shared_ptr<Environment> Scenario::getEnvironment() {
 	return environment_;
 }
 
+std::vector<double> Scenario::getObjectives() {
+	return std::vector<double>();
+}
+
 
 }
@@ -136,6 +136,13 @@ public:
 	 */
 	virtual double getFitness() = 0;
 
+	/**
+	 * Compute the objectives for multi-objective evolution, all to be
+	 * maximized. Called after getFitness.
+	 * @return objectives, empty (the default) if the fitness is the only one
+	 */
+	virtual std::vector<double> getObjectives();
+
 	/**
 	 * @return true if another trial must be executed
 	 */
@@ -50,6 +50,10 @@
 #include "QScriptScenario.h"
 #endif
 
+#ifndef EMSCRIPTEN
+#include "scenario/NativeScenario.h"
+#endif
+
 
 
 
@@ -70,7 +74,15 @@ boost::shared_ptr<Scenario> ScenarioFactory::createScenario(boost::shared_ptr<Ro
 		return boost::shared_ptr<Scenario>(new RacingScenario(config));
 	} else if (config->getScenario() == "chasing") {
 		return boost::shared_ptr<Scenario>(new ChasingScenario(config));
-	} else {
+	}
+#ifndef EMSCRIPTEN
+	else if (NativeScenario::isNativeScenario(config->getScenario())) {
+		std::cout << "Using native scenario plugin " << config->getScenario()
+				<< std::endl;
+		return NativeScenario::createScenario(config);
+	}
+#endif
+	else {
 		// we are getting scenario in js
 #ifdef EMSCRIPTEN
 
@@ -0,0 +1,104 @@
+/*
+ * @(#) ScenarioPlugin.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_SCENARIO_PLUGIN_H_
+#define ROBOGEN_SCENARIO_PLUGIN_H_
+
+#include <boost/shared_ptr.hpp>
+#include "scenario/Scenario.h"
+
+/**
+ * Version of the scenario plugin interface. Must be bumped whenever the
+ * layout of Scenario, Robot, Environment or anything else a plugin can touch
+ * changes, so that stale plugins are refused instead of crashing the
+ * simulator.
+ */
+#define ROBOGEN_SCENARIO_PLUGIN_ABI_VERSION 2
+
+/**
+ * Names of the symbols every scenario plugin must export
+ */
+#define ROBOGEN_SCENARIO_PLUGIN_VERSION_SYMBOL "robogenScenarioPluginAbiVersion"
+#define ROBOGEN_SCENARIO_PLUGIN_CREATE_SYMBOL "robogenCreateScenario"
+#define ROBOGEN_SCENARIO_PLUGIN_DESTROY_SYMBOL "robogenDestroyScenario"
+
+#ifdef WIN32
+#define ROBOGEN_SCENARIO_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define ROBOGEN_SCENARIO_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+extern "C" {
+
+/**
+ * @return the ROBOGEN_SCENARIO_PLUGIN_ABI_VERSION the plugin was built with
+ */
+typedef unsigned int (*RobogenScenarioPluginVersionFunction)();
+
+/**
+ * Creates a new scenario.
+ * @param config pointer to the shared configuration, the plugin must copy
+ * 		the shared_ptr if it wants to keep it
+ * @return the scenario, or NULL on failure
+ */
+typedef robogen::Scenario* (*RobogenScenarioPluginCreateFunction)(
+		const boost::shared_ptr<robogen::RobogenConfig> *config);
+
+/**
+ * Destroys a scenario created by the same plugin, so that allocation and
+ * deallocation happen on the same side of the library boundary
+ */
+typedef void (*RobogenScenarioPluginDestroyFunction)(
+		robogen::Scenario *scenario);
+
+}
+
+/**
+ * Exports the entry points for a native scenario plugin. A plugin only has to
+ * implement a subclass of robogen::Scenario with a constructor taking a
+ * boost::shared_ptr<RobogenConfig>, and then use this macro once in one of
+ * its source files:
+ *
+ * ROBOGEN_SCENARIO_PLUGIN(MyScenario)
+ */
+#define ROBOGEN_SCENARIO_PLUGIN(ScenarioClass) \
+	extern "C" { \
+	ROBOGEN_SCENARIO_PLUGIN_EXPORT unsigned int \
+	robogenScenarioPluginAbiVersion() { \
+		return ROBOGEN_SCENARIO_PLUGIN_ABI_VERSION; \
+	} \
+	ROBOGEN_SCENARIO_PLUGIN_EXPORT robogen::Scenario* robogenCreateScenario( \
+			const boost::shared_ptr<robogen::RobogenConfig> *config) { \
+		return new ScenarioClass(*config); \
+	} \
+	ROBOGEN_SCENARIO_PLUGIN_EXPORT void robogenDestroyScenario( \
+			robogen::Scenario *scenario) { \
+		delete scenario; \
+	} \
+	}
+
+#endif /* ROBOGEN_SCENARIO_PLUGIN_H_ */
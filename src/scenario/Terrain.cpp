@@ -25,10 +25,7 @@
  *
  * @(#) $Id$
  */
-#ifndef DISABLE_HEIGHT_MAP
-#include <osgDB/ReadFile>
-#endif
-#include <osg/Image>
+#include <iostream>
 #include "scenario/Terrain.h"
 
 
@@ -55,6 +52,7 @@ bool Terrain::initFlat(float width, float depth) {
 
 	if (this->heightField_ != NULL) {
 		dGeomHeightfieldDataDestroy(this->heightField_);
+		this->heightField_ = NULL;
 	}
 
 	dCreatePlane(odeSpace_, 0.0, 0.0, 1.0, 0.0);
@@ -71,8 +69,8 @@ bool Terrain::initFlat(float width, float depth) {
 bool Terrain::initRough(const std::string& heightMapFileName, float width,
 		float depth, float height) {
 
-	osg::ref_ptr<osg::Image> image = osgDB::readImageFile(heightMapFileName);
-	if (image == NULL) {
+	heightMap_ = HeightMap::load(heightMapFileName);
+	if (!heightMap_) {
 		std::cout << "Cannot load the height map file '" << heightMapFileName
 				<< "' for the terrain. Quit." << std::endl;
 		return false;
@@ -80,57 +78,47 @@ bool Terrain::initRough(const std::string& heightMapFileName, float width,
 
 	type_ = TerrainConfig::ROUGH;
 
-	// Try with trimesh!!
-	heightFieldData_ = image;
-
 	heightFieldWidth_ = width;
 	heightFieldDepth_ = depth;
 	heightFieldHeight_ = height;
 
-	int xCount = image->s();
-	int yCount = image->t();
-
-	float startX = -width / 2;
-	float startY = -depth / 2;
-
-	float spacingX = width / (xCount - 1);
-	float spacingY = depth / (yCount - 1);
-
-	double *mapData = new double[xCount * yCount * 3];
-	for (int x = 0; x < xCount; ++x) {
-		for (int y = 0; y < yCount; ++y) {
-
-			int j = x + xCount * y;
-
-			mapData[3 * j] = startX + spacingX * x;
-			mapData[3 * j + 1] = startY + spacingY * y;
-			mapData[3 * j + 2] = (*image->data(x, y) / 255.0) * height;
-
-		}
+	if (this->heightField_ != NULL) {
+		dGeomHeightfieldDataDestroy(this->heightField_);
 	}
-
-	dTriIndex *indices = new dTriIndex[xCount * yCount * 3];
-	int index = 0;
-	for (int c = 0; c < xCount * yCount; ++c) {
-		indices[index++] = c;
-		indices[index++] = c + xCount;
-		indices[index++] = c + 1;
+	heightField_ = dGeomHeightfieldDataCreate();
+
+	// samples are not copied, heightMap_ keeps them alive
+	// thickness below the lowest point to avoid bodies tunneling through
+	const dReal thickness = 1.0;
+	if (heightMap_->getSampleType() == HeightMap::BYTE_SAMPLES) {
+		dGeomHeightfieldDataBuildByte(heightField_,
+				static_cast<const unsigned char*>(heightMap_->getData()), 0,
+				width, depth, heightMap_->getNumCols(),
+				heightMap_->getNumRows(), height / 255.0, 0, thickness, 0);
+	} else {
+		dGeomHeightfieldDataBuildSingle(heightField_,
+				static_cast<const float*>(heightMap_->getData()), 0,
+				width, depth, heightMap_->getNumCols(),
+				heightMap_->getNumRows(), height, 0, thickness, 0);
 	}
+	dGeomHeightfieldDataSetBounds(heightField_, 0, height);
 
-	dTriMeshDataID trimesh = dGeomTriMeshDataCreate();
-	dGeomTriMeshDataBuildDouble(trimesh, &mapData[0], 3 * sizeof(double),
-			xCount * yCount, &indices[0], xCount * yCount * 3,
-			3 * sizeof(dTriIndex));
+	odeGeometry_ = dCreateHeightfield(odeSpace_, heightField_, 1);
 
-	odeGeometry_ = dCreateTriMesh(odeSpace_, trimesh, 0, 0, 0);
+	// ODE heightfields are y-up: rotate so that height is along z.
+	// Local z then points to -y, which is why HeightMap stores rows starting
+	// from the maximum y.
+	dMatrix3 rotation;
+	dRFromAxisAndAngle(rotation, 1, 0, 0, M_PI / 2);
+	dGeomSetRotation(odeGeometry_, rotation);
 
 	return true;
 
 }
 #endif
 
-osg::ref_ptr<osg::Image> Terrain::getHeightFieldData() {
-	return heightFieldData_;
+boost::shared_ptr<const HeightMap> Terrain::getHeightMap() {
+	return heightMap_;
 }
 
 float Terrain::getWidth() const {
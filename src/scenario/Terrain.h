@@ -28,14 +28,11 @@
 #ifndef ROBOGEN_TERRAIN_H_
 #define ROBOGEN_TERRAIN_H_
 
-#include <osg/ref_ptr>
 #include <string>
+#include <boost/shared_ptr.hpp>
 #include "Robogen.h"
 #include "config/TerrainConfig.h"
-
-namespace osg {
-class Image;
-}
+#include "scenario/HeightMap.h"
 
 namespace robogen {
 
@@ -73,7 +70,8 @@ public:
 	/**
 	 * Initializes a rough terrain
 	 *
-	 * @param heightMapFileName the height map file defining terrain elevation contains a nxm matrix of byte values (0-255).
+	 * @param heightMapFileName the height map file defining terrain elevation,
+	 *                          an image or a raw height map (see HeightMap).
 	 *                          0 Corresponds to the lower elevation, 1 to the maximum elevation
 	 * @param width
 	 * @param depth
@@ -86,7 +84,7 @@ public:
 	/**
 	 * @return the heightfield data
 	 */
-	osg::ref_ptr<osg::Image> getHeightFieldData();
+	boost::shared_ptr<const HeightMap> getHeightMap();
 
 	/**
 	 * @return width
@@ -132,9 +130,9 @@ private:
 	dHeightfieldDataID heightField_;
 
 	/**
-	 * Height field data
+	 * Height field data, shared with all other terrains using the same file
 	 */
-	osg::ref_ptr<osg::Image> heightFieldData_;
+	boost::shared_ptr<const HeightMap> heightMap_;
 
 	/**
 	 * Height field depth, width and height
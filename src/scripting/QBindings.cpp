@@ -232,6 +232,44 @@ QScriptValue QBoxObstacle::getSize() {
 			basePtr_.lock())->getSize());
 }
 
+// StepSampler
+
+StepSampler::StepSampler() : count_(0) {}
+
+void StepSampler::reset(boost::shared_ptr<Robot> robot) {
+	coreComponent_ = robot->getCoreComponent();
+	std::vector<boost::shared_ptr<Sensor> > sensors = robot->getSensors();
+	sensors_.assign(sensors.begin(), sensors.end());
+	count_ = 0;
+	corePosition_.clear();
+	sensorValues_.clear();
+}
+
+void StepSampler::record() {
+	osg::Vec3 position = coreComponent_.lock()->getRootPosition();
+	corePosition_.push_back(position.x());
+	corePosition_.push_back(position.y());
+	corePosition_.push_back(position.z());
+	for (size_t i = 0; i < sensors_.size(); ++i) {
+		sensorValues_.push_back(sensors_[i].lock()->read());
+	}
+	count_++;
+}
+
+QScriptValue StepSampler::flush(QScriptEngine *engine) {
+	QScriptValue samples = engine->newObject();
+	samples.setProperty("count", count_);
+	samples.setProperty("numSensors", (unsigned int) sensors_.size());
+	samples.setProperty("corePosition", arrayFromVector(engine,
+			corePosition_));
+	samples.setProperty("sensors", arrayFromVector(engine, sensorValues_));
+
+	count_ = 0;
+	corePosition_.clear();
+	sensorValues_.clear();
+	return samples;
+}
+
 // QEnvironment
 QEnvironment::QEnvironment(boost::weak_ptr<Environment> basePtr) :
 		basePtr_(basePtr) {}
@@ -156,6 +156,46 @@ public slots:
 	QScriptValue getSize();
 };
 
+/**
+ * Records per step samples of the robot natively, so that scripts can
+ * receive a whole batch of them in a single call instead of querying the
+ * bindings above at every step.
+ *
+ * A batch is exposed to scripts as an object with
+ * 	count: number of recorded steps
+ * 	corePosition: flat array [x0, y0, z0, x1, y1, z1, ...]
+ * 	numSensors: number of sensor values per step
+ * 	sensors: flat array of count * numSensors values, in the order of
+ * 			 robot.getSensors()
+ */
+class StepSampler {
+public:
+	StepSampler();
+
+	/**
+	 * Start recording a new trial for the given robot
+	 */
+	void reset(boost::shared_ptr<Robot> robot);
+
+	/**
+	 * Record the current state
+	 */
+	void record();
+
+	/**
+	 * @return the samples recorded since the last flush, and clears them
+	 */
+	QScriptValue flush(QScriptEngine *engine);
+
+private:
+	boost::weak_ptr<Model> coreComponent_;
+	std::vector<boost::weak_ptr<Sensor> > sensors_;
+
+	unsigned int count_;
+	std::vector<double> corePosition_;
+	std::vector<double> sensorValues_;
+};
+
 class QEnvironment : public QObject, public QScriptable {
 	Q_OBJECT
 public:
@@ -0,0 +1,146 @@
+/*
+ * @(#) CmaesTest.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * Checks that CMA-ES minimizes a sphere function over the brain genome of a
+ * robot, while every other sample keeps a better, but low fidelity, fitness
+ * that has to rank below all fully evaluated samples.
+ *
+ * Usage: CmaesTest <robot file>
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
+#include "config/EvolverConfiguration.h"
+#include "evolution/engine/Population.h"
+#include "evolution/engine/cmaes/CmaesOptimizer.h"
+#include "evolution/representation/RobotRepresentation.h"
+#include "utils/SimulationProfile.h"
+
+using namespace robogen;
+
+// needed by the simulation code linked in with the robogen library
+thread_local dWorldID odeWorld;
+thread_local dJointGroupID odeContactGroup;
+
+namespace {
+
+// optimum of every gene, all genes being searched in [0, 1]
+const double TARGET = 0.3;
+
+/**
+ * Distance of the brain genome to the optimum, as a fitness to maximize
+ */
+double sphere(boost::shared_ptr<RobotRepresentation> &robot) {
+	std::vector<double*> weights;
+	std::vector<double*> params;
+	std::vector<unsigned int> types;
+	robot->getBrainGenome(weights, types, params);
+	weights.insert(weights.end(), params.begin(), params.end());
+
+	double fitness = 0;
+	for (unsigned int i = 0; i < weights.size(); ++i) {
+		fitness -= (*weights[i] - TARGET) * (*weights[i] - TARGET);
+	}
+	return fitness;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+
+	if (argc != 2) {
+		std::cerr << "Usage: " << argv[0] << " <robot file>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	boost::shared_ptr<RobotRepresentation> robot(new RobotRepresentation());
+	if (!robot->init(argv[1])) {
+		std::cerr << "Cannot load robot " << argv[1] << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	boost::shared_ptr<EvolverConfiguration> conf(new EvolverConfiguration());
+	conf->mu = 6;
+	conf->lambda = 24;
+	conf->cmaesSigma = 0.3;
+	conf->cmaesMaxRestarts = 0;
+	conf->minBrainWeight = conf->minBrainBias = conf->minBrainTau =
+			conf->minBrainPeriod = conf->minBrainPhaseOffset =
+			conf->minBrainAmplitude = 0;
+	conf->maxBrainWeight = conf->maxBrainBias = conf->maxBrainTau =
+			conf->maxBrainPeriod = conf->maxBrainPhaseOffset =
+			conf->maxBrainAmplitude = 1;
+
+	boost::random::mt19937 rng(42);
+	CmaesOptimizer optimizer(conf, rng);
+	boost::shared_ptr<Population> population(new Population());
+	population->push_back(robot);
+	if (!optimizer.fillPopulationWeights(population)) {
+		return EXIT_FAILURE;
+	}
+
+	SimulationProfile profile;
+	std::vector<double> objectives;
+	double first = 0, best = -1e30;
+	unsigned int generation;
+	for (generation = 0; generation < 5000 && best < -1e-8; ++generation) {
+		double generationBest = -1e30;
+		for (unsigned int i = 0; i < population->size(); ++i) {
+			double fitness = sphere(population->at(i));
+			if (i % 2) {
+				// better than any full fidelity fitness, on another scale
+				population->at(i)->setEvaluationResult(1, objectives,
+						profile, true);
+			} else {
+				population->at(i)->setEvaluationResult(fitness, objectives,
+						profile, false);
+				generationBest = std::max(generationBest, fitness);
+			}
+		}
+		if (generation == 0) {
+			first = generationBest;
+		}
+		best = generationBest;
+		if (!optimizer.produceNextGeneration(population)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::cout << "CMA-ES: best fitness " << first << " in the first "
+			"generation, " << best << " after " << generation << std::endl;
+	if (best < -1e-8) {
+		std::cerr << "CMA-ES did not converge on the sphere function"
+				<< std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
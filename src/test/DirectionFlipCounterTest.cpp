@@ -0,0 +1,150 @@
+/*
+ * @(#) DirectionFlipCounterTest.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * Checks the incremental direction flip count of the motors against a
+ * rescan of the window of control signals, for both ways motors derive
+ * directions: the sign of the signal (rotation motors) and the sign of its
+ * change (servos, n signals giving n - 1 changes).
+ */
+
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "model/motors/DirectionFlipCounter.h"
+
+using namespace robogen;
+
+namespace {
+
+int sgn(float value) {
+	return (0 < value) - (value < 0);
+}
+
+/**
+ * Direction flips in a window of signals, by rescanning it from the oldest
+ * signal, zero directions being skipped
+ */
+unsigned int rescanFlips(const std::deque<float> &signals,
+		bool signalChange) {
+	unsigned int flips = 0;
+	int previous = 0;
+	for (unsigned int i = signalChange ? 1 : 0; i < signals.size(); ++i) {
+		int current = signalChange ? sgn(signals[i] - signals[i - 1]) :
+				sgn(signals[i]);
+		if (current != 0) {
+			if (previous * current < 0) {
+				++flips;
+			}
+			previous = current;
+		}
+	}
+	return flips;
+}
+
+/**
+ * Feed signals to a counter as Motor::testBurnout does, and compare its
+ * count with a rescan after every signal
+ * @return false on the first mismatch
+ */
+bool check(const std::vector<float> &signals, unsigned int historySize,
+		bool signalChange, unsigned int &checks) {
+
+	DirectionFlipCounter counter;
+	counter.reset((signalChange && historySize > 0) ? historySize - 1 :
+			historySize);
+
+	std::deque<float> window;
+	float previousSignal = 0;
+	for (unsigned int i = 0; i < signals.size(); ++i) {
+		if (!signalChange) {
+			counter.push(sgn(signals[i]));
+		} else if (i > 0) {
+			counter.push(sgn(signals[i] - previousSignal));
+		}
+		previousSignal = signals[i];
+
+		window.push_back(signals[i]);
+		if (window.size() > historySize) {
+			window.pop_front();
+		}
+		if (window.size() < 2) {
+			continue;
+		}
+
+		unsigned int expected = rescanFlips(window, signalChange);
+		++checks;
+		if (counter.getFlips() != expected) {
+			std::cerr << (signalChange ? "servo" : "rotation motor")
+					<< ", history of " << historySize << ": "
+					<< counter.getFlips() << " flips counted after signal "
+					<< i << ", " << expected << " expected" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+int main() {
+
+	boost::random::mt19937 rng(42);
+	unsigned int historySizes[] = { 1, 2, 3, 4, 7, 50 };
+	unsigned int checks = 0;
+
+	for (unsigned int trial = 0; trial < 200; ++trial) {
+
+		// few distinct values, held for random durations: repeated and zero
+		// signals, and runs of zero changes longer than the window
+		boost::random::uniform_int_distribution<int> value(-2, 2);
+		boost::random::uniform_int_distribution<int> hold(1,
+				(trial % 2) ? 3 : 80);
+		std::vector<float> signals;
+		while (signals.size() < 2000) {
+			float signal = value(rng) * 0.25f;
+			for (int i = hold(rng); i > 0; --i) {
+				signals.push_back(signal);
+			}
+		}
+
+		for (unsigned int i = 0; i < 6; ++i) {
+			if (!check(signals, historySizes[i], false, checks) ||
+					!check(signals, historySizes[i], true, checks)) {
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	std::cout << "DirectionFlipCounter: " << checks << " counts match"
+			<< std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/*
+ * @(#) NoiseGeneratorTest.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * Checks the noise generator: the Philox4x32-10 known answer for the first
+ * block, the moments of both distributions, and that the sequence only
+ * depends on the key and on how many variates were consumed, not on how
+ * they were requested.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "utils/NoiseGenerator.h"
+
+using namespace robogen;
+
+namespace {
+
+const unsigned int BLOCK_SIZE = NoiseGenerator::BLOCK_SIZE;
+
+/**
+ * Noise added to ones, i.e. the variates scaled by level
+ */
+std::vector<float> draw(NoiseGenerator &generator, unsigned int n,
+		bool gaussian, unsigned int chunk) {
+	std::vector<float> values(n, 1.0f);
+	for (unsigned int i = 0; i < n; i += chunk) {
+		unsigned int count = std::min(chunk, n - i);
+		if (gaussian) {
+			generator.addGaussianNoise(&values[i], count, 1.0f);
+		} else {
+			generator.addUniformNoise(&values[i], count, 1.0f);
+		}
+	}
+	for (unsigned int i = 0; i < n; ++i) {
+		values[i] -= 1.0f;
+	}
+	return values;
+}
+
+bool checkKnownAnswer() {
+	// Philox4x32-10 of counter 0 under key 0 (Random123 known answer), the
+	// words of a Philox block being LANES apart in a generated block
+	const boost::uint32_t words[] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+			0x9b00dbd8 };
+	const unsigned int lanes = BLOCK_SIZE / 4;
+
+	NoiseGenerator generator;
+	generator.seed(0);
+	std::vector<float> noise = draw(generator, BLOCK_SIZE, false,
+			BLOCK_SIZE);
+	for (unsigned int i = 0; i < 4; ++i) {
+		float expected = (words[i] >> 8) / 16777216.0f * 2.0f - 1.0f;
+		if (std::fabs(noise[i * lanes] - expected) > 1e-6) {
+			std::cerr << "Philox word " << i << " of the first block: "
+					<< noise[i * lanes] << " drawn, " << expected
+					<< " expected" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool checkMoments(bool gaussian, double mean, double variance) {
+	const unsigned int n = 1 << 20;
+	NoiseGenerator generator;
+	generator.seed(12345);
+	std::vector<float> noise = draw(generator, n, gaussian, BLOCK_SIZE);
+
+	double sum = 0, squares = 0;
+	for (unsigned int i = 0; i < n; ++i) {
+		sum += noise[i];
+		squares += noise[i] * noise[i];
+	}
+	double sampleMean = sum / n;
+	double sampleVariance = squares / n - sampleMean * sampleMean;
+	// a few standard errors, for about a million variates
+	if (std::fabs(sampleMean - mean) > 0.005 ||
+			std::fabs(sampleVariance - variance) > 0.01) {
+		std::cerr << (gaussian ? "Gaussian" : "uniform")
+				<< " noise: mean " << sampleMean << ", variance "
+				<< sampleVariance << ", expected " << mean << " and "
+				<< variance << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool checkSequence(bool gaussian) {
+	const unsigned int n = 5 * BLOCK_SIZE + 17;
+	const char *name = gaussian ? "Gaussian" : "uniform";
+
+	NoiseGenerator generator;
+	generator.seed(7);
+	std::vector<float> reference = draw(generator, n, gaussian, n);
+
+	// reseeding restarts the sequence, whatever was consumed before
+	generator.seed(7);
+	if (draw(generator, n, gaussian, n) != reference) {
+		std::cerr << name << " noise: reseeding does not restart the "
+				"sequence" << std::endl;
+		return false;
+	}
+
+	unsigned int chunks[] = { 1, 3, 100, BLOCK_SIZE - 1, BLOCK_SIZE,
+			BLOCK_SIZE + 1 };
+	for (unsigned int i = 0; i < 6; ++i) {
+		NoiseGenerator chunked;
+		chunked.seed(7);
+		if (draw(chunked, n, gaussian, chunks[i]) != reference) {
+			std::cerr << name << " noise drawn by " << chunks[i]
+					<< " differs from a single draw" << std::endl;
+			return false;
+		}
+	}
+
+	NoiseGenerator other;
+	other.seed(8);
+	if (draw(other, n, gaussian, n) == reference) {
+		std::cerr << name << " noise does not depend on the key"
+				<< std::endl;
+		return false;
+	}
+	return true;
+}
+
+}
+
+int main() {
+
+	if (!checkKnownAnswer() || !checkMoments(false, 0, 1. / 3) ||
+			!checkMoments(true, 0, 1) || !checkSequence(false) ||
+			!checkSequence(true)) {
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "NoiseGenerator: known answer, moments and sequence "
+			"match" << std::endl;
+	return EXIT_SUCCESS;
+}
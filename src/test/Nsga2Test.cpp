@@ -0,0 +1,202 @@
+/*
+ * @(#) Nsga2Test.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+/*
+ * Checks the NSGA-II non-dominated sorting against the original O(MN^2)
+ * procedure, the crowding distances on a known front, and that reduction
+ * keeps fully evaluated individuals before low fidelity ones.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "evolution/engine/selectors/Nsga2.h"
+#include "utils/SimulationProfile.h"
+
+using namespace robogen;
+
+// needed by the simulation code linked in with the robogen library
+thread_local dWorldID odeWorld;
+thread_local dJointGroupID odeContactGroup;
+
+namespace {
+
+bool dominates(const std::vector<double> &a, const std::vector<double> &b) {
+	bool better = false;
+	for (unsigned int i = 0; i < a.size(); ++i) {
+		if (a[i] < b[i]) {
+			return false;
+		}
+		better |= (a[i] > b[i]);
+	}
+	return better;
+}
+
+/**
+ * Fronts by repeatedly taking the individuals no remaining one dominates
+ */
+std::vector<std::vector<unsigned int> > bruteForceFronts(
+		const std::vector<std::vector<double> > &objectives) {
+	std::vector<std::vector<unsigned int> > fronts;
+	std::vector<bool> assigned(objectives.size(), false);
+	unsigned int nAssigned = 0;
+	while (nAssigned < objectives.size()) {
+		std::vector<unsigned int> front;
+		for (unsigned int i = 0; i < objectives.size(); ++i) {
+			if (assigned[i]) {
+				continue;
+			}
+			bool dominated = false;
+			for (unsigned int j = 0; j < objectives.size() && !dominated;
+					++j) {
+				dominated = !assigned[j] &&
+						dominates(objectives[j], objectives[i]);
+			}
+			if (!dominated) {
+				front.push_back(i);
+			}
+		}
+		for (unsigned int i = 0; i < front.size(); ++i) {
+			assigned[front[i]] = true;
+		}
+		nAssigned += front.size();
+		fronts.push_back(front);
+	}
+	return fronts;
+}
+
+bool checkSorting(boost::random::mt19937 &rng) {
+	for (unsigned int trial = 0; trial < 500; ++trial) {
+		boost::random::uniform_int_distribution<unsigned int> size(1, 60);
+		boost::random::uniform_int_distribution<unsigned int> dimension(1, 3);
+		// few distinct values, for ties and duplicates
+		boost::random::uniform_int_distribution<int> value(0, 4);
+
+		std::vector<std::vector<double> > objectives(size(rng));
+		unsigned int m = dimension(rng);
+		for (unsigned int i = 0; i < objectives.size(); ++i) {
+			for (unsigned int j = 0; j < m; ++j) {
+				objectives[i].push_back(value(rng));
+			}
+		}
+
+		std::vector<std::vector<unsigned int> > fronts;
+		Nsga2::sortFronts(objectives, fronts);
+		for (unsigned int f = 0; f < fronts.size(); ++f) {
+			std::sort(fronts[f].begin(), fronts[f].end());
+		}
+		if (fronts != bruteForceFronts(objectives)) {
+			std::cerr << "Fronts differ from the brute force ones for "
+					<< objectives.size() << " individuals, " << m
+					<< " objectives" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool checkCrowding() {
+	std::vector<std::vector<double> > objectives;
+	double points[][2] = { { 0, 4 }, { 1, 3 }, { 2, 2 }, { 4, 0 } };
+	for (unsigned int i = 0; i < 4; ++i) {
+		objectives.push_back(std::vector<double>(points[i], points[i] + 2));
+	}
+	std::vector<unsigned int> front;
+	for (unsigned int i = 0; i < 4; ++i) {
+		front.push_back(i);
+	}
+
+	std::vector<double> distances;
+	Nsga2::crowdingDistances(objectives, front, distances);
+	const double infinity = std::numeric_limits<double>::infinity();
+	double expected[] = { infinity, 1.0, 1.5, infinity };
+	for (unsigned int i = 0; i < 4; ++i) {
+		if (!(distances[i] == expected[i] ||
+				std::fabs(distances[i] - expected[i]) < 1e-12)) {
+			std::cerr << "Crowding distance of point " << i << " is "
+					<< distances[i] << ", " << expected[i] << " expected"
+					<< std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool checkLowFidelityReduction() {
+	// low fidelity individuals dominate all the others, but must only be
+	// kept once the fully evaluated ones are
+	std::vector<boost::shared_ptr<RobotRepresentation> > individuals;
+	for (unsigned int i = 0; i < 8; ++i) {
+		bool lowFidelity = (i % 2 == 0);
+		std::vector<double> objectives;
+		objectives.push_back(lowFidelity ? 10. + i : i);
+		objectives.push_back(lowFidelity ? 10. - i : -1. * i);
+		boost::shared_ptr<RobotRepresentation> robot(
+				new RobotRepresentation());
+		robot->setEvaluationResult(objectives[0], objectives,
+				SimulationProfile(), lowFidelity);
+		individuals.push_back(robot);
+	}
+
+	for (unsigned int popSize = 1; popSize <= 6; ++popSize) {
+		std::vector<boost::shared_ptr<RobotRepresentation> > kept =
+				individuals;
+		Nsga2::reduce(kept, popSize);
+		unsigned int nLowFidelity = 0;
+		for (unsigned int i = 0; i < kept.size(); ++i) {
+			nLowFidelity += kept[i]->isLowFidelity();
+		}
+		unsigned int expected = (popSize > 4) ? popSize - 4 : 0;
+		if (kept.size() != popSize || nLowFidelity != expected) {
+			std::cerr << "Reducing to " << popSize << " kept "
+					<< kept.size() << " individuals, " << nLowFidelity
+					<< " of them low fidelity, " << expected << " expected"
+					<< std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+int main() {
+	boost::random::mt19937 rng(42);
+	if (!checkSorting(rng) || !checkCrowding() ||
+			!checkLowFidelityReduction()) {
+		return EXIT_FAILURE;
+	}
+	std::cout << "NSGA-II: sorting, crowding distances and reduction match"
+			<< std::endl;
+	return EXIT_SUCCESS;
+}
@@ -49,10 +49,10 @@
 using namespace robogen;
 
 // ODE World
-dWorldID odeWorld;
+thread_local dWorldID odeWorld;
 
 // Container for collisions
-dJointGroupID odeContactGroup;
+thread_local dJointGroupID odeContactGroup;
 
 std::vector<boost::shared_ptr<TouchSensor> > touchSensors;
 
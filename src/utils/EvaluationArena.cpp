@@ -0,0 +1,166 @@
+/*
+ * @(#) EvaluationArena.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include <cstdlib>
+#include <iostream>
+#include "utils/EvaluationArena.h"
+
+namespace robogen {
+
+thread_local EvaluationArena *EvaluationArena::current_ = NULL;
+
+EvaluationArena &EvaluationArena::get() {
+	static thread_local ThreadReference reference;
+	if (reference.arena == NULL) {
+		reference.arena = new EvaluationArena();
+		current_ = reference.arena;
+	}
+	return *reference.arena;
+}
+
+EvaluationArena::ThreadReference::~ThreadReference() {
+	if (arena != NULL) {
+		current_ = NULL;
+		arena->release();
+	}
+}
+
+EvaluationArena::EvaluationArena() : largeSize_(0), currentBlock_(0),
+		offset_(0), references_(1), warningCapacity_(WARNING_CAPACITY) {
+}
+
+EvaluationArena::~EvaluationArena() {
+	for (unsigned int i = 0; i < blocks_.size(); ++i) {
+		std::free(blocks_[i]);
+	}
+	for (unsigned int i = 0; i < large_.size(); ++i) {
+		std::free(large_[i]);
+	}
+}
+
+void *EvaluationArena::allocate(std::size_t size, std::size_t alignment) {
+
+	// the last objects were released by another thread
+	if (references_ == 1 && !isRewound()) {
+		rewind();
+	}
+
+	if (size + alignment > BLOCK_SIZE) {
+		char *memory = static_cast<char*>(std::malloc(size));
+		if (memory == NULL) {
+			throw std::bad_alloc();
+		}
+		large_.push_back(memory);
+		largeSize_ += size;
+		++references_;
+		checkCapacity();
+		return memory;
+	}
+
+	if (blocks_.empty()) {
+		blocks_.push_back(static_cast<char*>(std::malloc(BLOCK_SIZE)));
+		if (blocks_.back() == NULL) {
+			blocks_.pop_back();
+			throw std::bad_alloc();
+		}
+	}
+
+	std::size_t start = (offset_ + alignment - 1) & ~(alignment - 1);
+	if (start + size > BLOCK_SIZE) {
+		++currentBlock_;
+		if (currentBlock_ == blocks_.size()) {
+			char *block = static_cast<char*>(std::malloc(BLOCK_SIZE));
+			if (block == NULL) {
+				--currentBlock_;
+				throw std::bad_alloc();
+			}
+			blocks_.push_back(block);
+			checkCapacity();
+		}
+		start = 0;
+	}
+
+	offset_ = start + size;
+	++references_;
+	return blocks_[currentBlock_] + start;
+}
+
+void EvaluationArena::deallocate(void *) {
+	// only the owner may touch the blocks, other threads leave the rewind to
+	// its next allocation. Nothing may touch the arena after the release:
+	// once its thread exited, the last object deletes it.
+	if (current_ == this) {
+		if (release() == 1) {
+			rewind();
+		}
+	} else {
+		release();
+	}
+}
+
+std::size_t EvaluationArena::release() {
+	std::size_t remaining = --references_;
+	if (remaining == 0) {
+		delete this;
+	}
+	return remaining;
+}
+
+std::size_t EvaluationArena::getCapacity() const {
+	return blocks_.size() * BLOCK_SIZE + largeSize_;
+}
+
+bool EvaluationArena::isRewound() const {
+	return currentBlock_ == 0 && offset_ == 0 && large_.empty();
+}
+
+void EvaluationArena::checkCapacity() {
+	// memory handed out since the last rewind, not the blocks kept for reuse
+	std::size_t used = currentBlock_ * BLOCK_SIZE + offset_ + largeSize_;
+	if (used <= warningCapacity_) {
+		return;
+	}
+	std::cerr << "The evaluation arena of this thread holds "
+			<< used / (1024 * 1024) << " MB without rewinding: "
+			<< getLiveAllocations() << " objects built for evaluations are "
+			<< "still alive" << std::endl;
+	while (warningCapacity_ < used) {
+		warningCapacity_ *= 2;
+	}
+}
+
+void EvaluationArena::rewind() {
+	for (unsigned int i = 0; i < large_.size(); ++i) {
+		std::free(large_[i]);
+	}
+	large_.clear();
+	largeSize_ = 0;
+	currentBlock_ = 0;
+	offset_ = 0;
+}
+
+}
@@ -0,0 +1,262 @@
+/*
+ * @(#) EvaluationArena.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_EVALUATION_ARENA_H_
+#define ROBOGEN_EVALUATION_ARENA_H_
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+#include <boost/make_shared.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace robogen {
+
+/**
+ * Monotonic memory for the objects built for one evaluation: the robot, its
+ * models, bodies, joints, connections, motors and sensors.
+ *
+ * Allocating is a pointer bump in the current block, freeing only counts the
+ * objects still alive: once the last one is gone the arena rewinds to its
+ * first block, releasing everything at once and reusing the same memory for
+ * the next evaluation.
+ *
+ * The arena only replaces malloc and free. Objects are still owned through
+ * boost::shared_ptr (see arenaShared), so their reference counts are still
+ * updated atomically and each is destroyed on its own.
+ *
+ * A single object that outlives its evaluation keeps the arena from
+ * rewinding, and the arena then grows with every evaluation: it reports on
+ * std::cerr once it uses WARNING_CAPACITY without rewinding, and again each
+ * time that doubles.
+ *
+ * There is one arena per thread, only that thread allocates from it. Objects
+ * may be released by other threads, the arena then rewinds the next time its
+ * own thread allocates. The arena is on the heap and counts as references
+ * its thread and every allocation still alive: objects released after their
+ * thread exited keep it alive, the last one deletes it.
+ */
+class EvaluationArena : private boost::noncopyable {
+
+public:
+
+	/**
+	 * Size of the blocks requested to the system
+	 */
+	static const std::size_t BLOCK_SIZE = 64 * 1024;
+
+	/**
+	 * Memory used without rewinding above which the arena reports it, and
+	 * again each time it doubles
+	 */
+	static const std::size_t WARNING_CAPACITY = 32 * 1024 * 1024;
+
+	/**
+	 * @return the arena of the calling thread
+	 */
+	static EvaluationArena &get();
+
+	void *allocate(std::size_t size, std::size_t alignment);
+
+	void deallocate(void *p);
+
+	/**
+	 * @return number of allocations not released yet, on the arena's thread
+	 */
+	std::size_t getLiveAllocations() const {
+		return references_ - 1;
+	}
+
+	/**
+	 * @return memory held by the arena, in bytes
+	 */
+	std::size_t getCapacity() const;
+
+private:
+
+	/**
+	 * Reference of a thread to its arena, dropped when the thread exits
+	 */
+	struct ThreadReference {
+		ThreadReference() : arena(NULL) {
+		}
+
+		~ThreadReference();
+
+		EvaluationArena *arena;
+	};
+
+	EvaluationArena();
+
+	~EvaluationArena();
+
+	/**
+	 * Drop a reference, deleting the arena with the last one
+	 * @return the remaining references
+	 */
+	std::size_t release();
+
+	/**
+	 * Release all the allocations, keeping the blocks for reuse
+	 */
+	void rewind();
+
+	/**
+	 * @return true if nothing was allocated since the last rewind
+	 */
+	bool isRewound() const;
+
+	/**
+	 * Report on std::cerr if the memory used since the last rewind grew past
+	 * warningCapacity_
+	 */
+	void checkCapacity();
+
+	std::vector<char*> blocks_;
+
+	/**
+	 * Allocations bigger than a block, freed on rewind
+	 */
+	std::vector<char*> large_;
+	std::size_t largeSize_;
+
+	unsigned int currentBlock_;
+	std::size_t offset_;
+
+	/**
+	 * The owning thread while it runs, plus the allocations not released
+	 * yet, also decremented by other threads
+	 */
+	std::atomic<std::size_t> references_;
+
+	std::size_t warningCapacity_;
+
+	/**
+	 * Arena of the calling thread, if it has one. Only the owning thread
+	 * allocates and rewinds.
+	 */
+	static thread_local EvaluationArena *current_;
+};
+
+/**
+ * Standard allocator on the arena of the thread constructing it
+ */
+template<typename T>
+class ArenaAllocator {
+
+public:
+
+	typedef T value_type;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+
+	template<typename U>
+	struct rebind {
+		typedef ArenaAllocator<U> other;
+	};
+
+	ArenaAllocator() : arena_(&EvaluationArena::get()) {
+	}
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U> &other) :
+			arena_(other.getArena()) {
+	}
+
+	pointer allocate(size_type n, const void* = 0) {
+		return static_cast<pointer>(arena_->allocate(n * sizeof(T),
+				alignof(T)));
+	}
+
+	void deallocate(pointer p, size_type) {
+		arena_->deallocate(p);
+	}
+
+	template<typename U, typename... Args>
+	void construct(U *p, Args&&... args) {
+		::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	}
+
+	template<typename U>
+	void destroy(U *p) {
+		p->~U();
+	}
+
+	pointer address(reference r) const {
+		return &r;
+	}
+
+	const_pointer address(const_reference r) const {
+		return &r;
+	}
+
+	size_type max_size() const {
+		return static_cast<size_type>(-1) / sizeof(T);
+	}
+
+	EvaluationArena *getArena() const {
+		return arena_;
+	}
+
+private:
+
+	EvaluationArena *arena_;
+};
+
+template<typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> &a,
+		const ArenaAllocator<U> &b) {
+	return a.getArena() == b.getArena();
+}
+
+template<typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> &a,
+		const ArenaAllocator<U> &b) {
+	return a.getArena() != b.getArena();
+}
+
+/**
+ * Create an object in the arena of the calling thread. The object and its
+ * reference count share one arena allocation, the object is still reference
+ * counted and destroyed as with boost::make_shared.
+ */
+template<typename T, typename... Args>
+inline boost::shared_ptr<T> arenaShared(Args&&... args) {
+	return boost::allocate_shared<T>(ArenaAllocator<T>(),
+			std::forward<Args>(args)...);
+}
+
+}
+
+#endif /* ROBOGEN_EVALUATION_ARENA_H_ */
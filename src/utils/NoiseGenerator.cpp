@@ -0,0 +1,165 @@
+/*
+ * @(#) NoiseGenerator.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include <algorithm>
+#include <cmath>
+#include "utils/NoiseGenerator.h"
+
+namespace robogen {
+
+namespace {
+
+const boost::uint32_t PHILOX_M0 = 0xD2511F53;
+const boost::uint32_t PHILOX_M1 = 0xCD9E8D57;
+const boost::uint32_t PHILOX_W0 = 0x9E3779B9;
+const boost::uint32_t PHILOX_W1 = 0xBB67AE85;
+const unsigned int PHILOX_ROUNDS = 10;
+
+// Philox blocks (of 4 words) per generated block
+const unsigned int LANES = NoiseGenerator::BLOCK_SIZE / 4;
+
+// 2^-24, to map the 24 high bits of a word to [0, 1)
+const float TO_UNIT = 1.0f / 16777216.0f;
+
+const float TWO_PI = 6.28318530717958647692f;
+
+}
+
+NoiseGenerator::NoiseGenerator() : counter_(0), gaussianUsed_(BLOCK_SIZE),
+		uniformUsed_(BLOCK_SIZE) {
+	key_[0] = 0;
+	key_[1] = 0;
+}
+
+void NoiseGenerator::seed(boost::uint64_t key) {
+	key_[0] = (boost::uint32_t) key;
+	key_[1] = (boost::uint32_t) (key >> 32);
+	counter_ = 0;
+	gaussianUsed_ = BLOCK_SIZE;
+	uniformUsed_ = BLOCK_SIZE;
+}
+
+void NoiseGenerator::generate(boost::uint32_t *words) {
+
+	// one lane per Philox counter, structure of arrays so that each round
+	// is a vectorizable loop
+	boost::uint32_t c0[LANES], c1[LANES], c2[LANES], c3[LANES];
+	for (unsigned int i = 0; i < LANES; ++i) {
+		boost::uint64_t counter = counter_ + i;
+		c0[i] = (boost::uint32_t) counter;
+		c1[i] = (boost::uint32_t) (counter >> 32);
+		c2[i] = 0;
+		c3[i] = 0;
+	}
+	counter_ += LANES;
+
+	boost::uint32_t k0 = key_[0];
+	boost::uint32_t k1 = key_[1];
+	for (unsigned int round = 0; round < PHILOX_ROUNDS; ++round) {
+		for (unsigned int i = 0; i < LANES; ++i) {
+			boost::uint64_t p0 = (boost::uint64_t) PHILOX_M0 * c0[i];
+			boost::uint64_t p1 = (boost::uint64_t) PHILOX_M1 * c2[i];
+			boost::uint32_t n0 = (boost::uint32_t) (p1 >> 32) ^ c1[i] ^ k0;
+			boost::uint32_t n2 = (boost::uint32_t) (p0 >> 32) ^ c3[i] ^ k1;
+			c1[i] = (boost::uint32_t) p1;
+			c3[i] = (boost::uint32_t) p0;
+			c0[i] = n0;
+			c2[i] = n2;
+		}
+		k0 += PHILOX_W0;
+		k1 += PHILOX_W1;
+	}
+
+	for (unsigned int i = 0; i < LANES; ++i) {
+		words[i] = c0[i];
+		words[LANES + i] = c1[i];
+		words[2 * LANES + i] = c2[i];
+		words[3 * LANES + i] = c3[i];
+	}
+}
+
+void NoiseGenerator::refillGaussian() {
+	boost::uint32_t words[BLOCK_SIZE];
+	generate(words);
+
+	// Box-Muller, each pair of words gives two variates
+	const unsigned int half = BLOCK_SIZE / 2;
+	for (unsigned int i = 0; i < half; ++i) {
+		// in (0, 1], so that the log is finite
+		float u1 = ((words[i] >> 8) + 1) * TO_UNIT;
+		float u2 = (words[half + i] >> 8) * TO_UNIT;
+		float radius = std::sqrt(-2.0f * std::log(u1));
+		gaussian_[i] = radius * std::cos(TWO_PI * u2);
+		gaussian_[half + i] = radius * std::sin(TWO_PI * u2);
+	}
+	gaussianUsed_ = 0;
+}
+
+void NoiseGenerator::refillUniform() {
+	boost::uint32_t words[BLOCK_SIZE];
+	generate(words);
+	for (unsigned int i = 0; i < BLOCK_SIZE; ++i) {
+		uniform_[i] = (words[i] >> 8) * TO_UNIT;
+	}
+	uniformUsed_ = 0;
+}
+
+void NoiseGenerator::addGaussianNoise(float *values, unsigned int n,
+		float level) {
+	while (n > 0) {
+		if (gaussianUsed_ == BLOCK_SIZE) {
+			refillGaussian();
+		}
+		unsigned int count = std::min(n, BLOCK_SIZE - gaussianUsed_);
+		const float *noise = gaussian_ + gaussianUsed_;
+		for (unsigned int i = 0; i < count; ++i) {
+			values[i] += noise[i] * level * values[i];
+		}
+		gaussianUsed_ += count;
+		values += count;
+		n -= count;
+	}
+}
+
+void NoiseGenerator::addUniformNoise(float *values, unsigned int n,
+		float level) {
+	while (n > 0) {
+		if (uniformUsed_ == BLOCK_SIZE) {
+			refillUniform();
+		}
+		unsigned int count = std::min(n, BLOCK_SIZE - uniformUsed_);
+		const float *noise = uniform_ + uniformUsed_;
+		for (unsigned int i = 0; i < count; ++i) {
+			values[i] += (noise[i] * 2.0f * level - level) * values[i];
+		}
+		uniformUsed_ += count;
+		values += count;
+		n -= count;
+	}
+}
+
+}
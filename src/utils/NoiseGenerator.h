@@ -0,0 +1,96 @@
+/*
+ * @(#) NoiseGenerator.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_NOISE_GENERATOR_H_
+#define ROBOGEN_NOISE_GENERATOR_H_
+
+#include <boost/cstdint.hpp>
+
+namespace robogen {
+
+/**
+ * Sensor and motor noise of one simulation.
+ *
+ * Variates come from a Philox4x32-10 counter-based generator: the n-th block
+ * is a pure function of the key and n, so blocks are generated with plain
+ * loops over independent counters, which the compiler vectorizes, and
+ * consumed as needed by whole arrays of sensor or motor values.
+ */
+class NoiseGenerator {
+
+public:
+
+	/**
+	 * Number of variates generated at once, of each kind
+	 */
+	static const unsigned int BLOCK_SIZE = 256;
+
+	NoiseGenerator();
+
+	/**
+	 * Restart from the first block of the sequence given by the key
+	 */
+	void seed(boost::uint64_t key);
+
+	/**
+	 * values[i] += N(0, 1) * level * values[i]
+	 */
+	void addGaussianNoise(float *values, unsigned int n, float level);
+
+	/**
+	 * values[i] += U(-level, level) * values[i]
+	 */
+	void addUniformNoise(float *values, unsigned int n, float level);
+
+private:
+
+	/**
+	 * Fill words with the next BLOCK_SIZE random 32 bit words
+	 */
+	void generate(boost::uint32_t *words);
+
+	void refillGaussian();
+
+	void refillUniform();
+
+	boost::uint32_t key_[2];
+
+	/**
+	 * Counter of the next Philox block (of 4 words)
+	 */
+	boost::uint64_t counter_;
+
+	float gaussian_[BLOCK_SIZE];
+	unsigned int gaussianUsed_;
+
+	float uniform_[BLOCK_SIZE];
+	unsigned int uniformUsed_;
+};
+
+}
+
+#endif /* ROBOGEN_NOISE_GENERATOR_H_ */
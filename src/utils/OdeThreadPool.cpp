@@ -0,0 +1,133 @@
+/*
+ * @(#) OdeThreadPool.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef EMSCRIPTEN
+
+#include <iostream>
+#include <boost/thread/mutex.hpp>
+
+#include "utils/OdeThreadPool.h"
+
+namespace robogen {
+
+namespace {
+
+boost::mutex poolMutex;
+dThreadingImplementationID threading = NULL;
+dThreadingThreadPoolID pool = NULL;
+unsigned int poolSize = 0;
+bool unavailable = false;
+dWorldID attachedWorld = NULL;
+
+void freePool() {
+	if (pool != NULL) {
+		dThreadingImplementationShutdownProcessing(threading);
+		dThreadingThreadPoolWaitIdleState(pool);
+		dThreadingFreeThreadPool(pool);
+		pool = NULL;
+	}
+	if (threading != NULL) {
+		dThreadingFreeImplementation(threading);
+		threading = NULL;
+		// release the reference taken when the pool was created
+		dCloseODE();
+	}
+	poolSize = 0;
+}
+
+}
+
+bool OdeThreadPool::attach(dWorldID world, unsigned int nThreads,
+		bool parallelIslands) {
+
+	boost::mutex::scoped_lock lock(poolMutex);
+
+	if (unavailable) {
+		return false;
+	}
+
+	if (attachedWorld != NULL && attachedWorld != world) {
+		std::cerr << "The ODE thread pool is already stepping another "
+				<< "world, this one will be stepped by a single thread."
+				<< std::endl;
+		return false;
+	}
+
+	if (poolSize != nThreads) {
+		freePool();
+
+		// keep ODE initialized while the pool threads exist: the simulator
+		// closes ODE after every trial
+		dInitODE2(0);
+		threading = dThreadingAllocateMultiThreadedImplementation();
+		if (threading != NULL) {
+			pool = dThreadingAllocateThreadPool(nThreads, 0,
+					dAllocateFlagBasicData, NULL);
+		}
+		if (pool == NULL) {
+			std::cerr << "ODE was built without its threading "
+					<< "implementation, worlds will be stepped by a single "
+					<< "thread." << std::endl;
+			// freePool() releases the reference of an allocated
+			// implementation, only close ODE here if there was none
+			bool allocated = (threading != NULL);
+			freePool();
+			if (!allocated) {
+				dCloseODE();
+			}
+			unavailable = true;
+			return false;
+		}
+		dThreadingThreadPoolServeMultiThreadedImplementation(pool, threading);
+		poolSize = nThreads;
+	}
+
+	dWorldSetStepIslandsProcessingMaxThreadCount(world,
+			parallelIslands ? 0 : 1);
+	dWorldSetStepThreadingImplementation(world,
+			dThreadingImplementationGetFunctions(threading), threading);
+	attachedWorld = world;
+	return true;
+}
+
+void OdeThreadPool::detach(dWorldID world) {
+	boost::mutex::scoped_lock lock(poolMutex);
+	if (world != attachedWorld) {
+		return;
+	}
+	dWorldSetStepThreadingImplementation(world, NULL, NULL);
+	attachedWorld = NULL;
+}
+
+void OdeThreadPool::shutdown() {
+	boost::mutex::scoped_lock lock(poolMutex);
+	freePool();
+}
+
+}
+
+#endif /* EMSCRIPTEN */
@@ -0,0 +1,91 @@
+/*
+ * @(#) OdeThreadPool.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_ODE_THREAD_POOL_H_
+#define ROBOGEN_ODE_THREAD_POOL_H_
+
+#ifndef EMSCRIPTEN
+
+#include "Robogen.h"
+
+namespace robogen {
+
+/**
+ * Process wide pool of threads used by ODE to step a world
+ * (ODE >= 0.13 threading implementation).
+ *
+ * The pool is created the first time a world is attached and then shared by
+ * all the following simulations of the process, it is only rebuilt if a
+ * different number of threads is requested.
+ *
+ * Only one world may be attached at a time: attaching another one fails
+ * until the first is detached.
+ */
+class OdeThreadPool {
+
+public:
+
+	/**
+	 * Let the world be stepped by the shared pool
+	 * @param world
+	 * @param nThreads number of threads of the pool
+	 * @param parallelIslands if false, islands are processed one after
+	 * 		the other (only the work inside each island is parallel). This is
+	 * 		needed to stay deterministic with dWorldQuickStep, that draws from
+	 * 		the global ODE random number generator.
+	 * @return false if ODE was built without its threading implementation
+	 * 		or if another world is attached, in which case the world is
+	 * 		stepped by the calling thread
+	 */
+	static bool attach(dWorldID world, unsigned int nThreads,
+			bool parallelIslands);
+
+	/**
+	 * Detach the pool from the world, must be called before destroying it.
+	 * Does nothing if the world is not the attached one.
+	 */
+	static void detach(dWorldID world);
+
+	/**
+	 * Stop and free the pool, if any
+	 */
+	static void shutdown();
+
+private:
+
+	/**
+	 * Disable instantiation
+	 */
+	OdeThreadPool();
+
+};
+
+}
+
+#endif /* EMSCRIPTEN */
+
+#endif /* ROBOGEN_ODE_THREAD_POOL_H_ */
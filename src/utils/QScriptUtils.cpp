@@ -58,6 +58,16 @@ QScriptValue valFromQuat(QScriptEngine* engine,
 	return result;
 }
 
+QScriptValue arrayFromVector(QScriptEngine* engine,
+		const std::vector<double> &values) {
+
+	QScriptValue result = engine->newArray(values.size());
+	for (size_t i = 0; i < values.size(); ++i) {
+		result.setProperty(i, values[i]);
+	}
+	return result;
+}
+
 }
 }
 
@@ -30,6 +30,7 @@
 
 #ifdef QT5_ENABLED
 
+#include <vector>
 #include <QScriptEngine>
 #include <osg/Vec3>
 #include <osg/Quat>
@@ -43,6 +44,12 @@ QScriptValue valFromVec3(QScriptEngine* engine,
 QScriptValue valFromQuat(QScriptEngine* engine,
 							osg::Quat quat);
 
+/**
+ * Copies values into a new, flat, script array
+ */
+QScriptValue arrayFromVector(QScriptEngine* engine,
+							const std::vector<double> &values);
+
 
 }
 }
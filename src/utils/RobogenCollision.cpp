@@ -35,10 +35,10 @@
 #include <algorithm>
 
 // ODE World
-extern dWorldID odeWorld;
+extern thread_local dWorldID odeWorld;
 
 // Container for collisions
-extern dJointGroupID odeContactGroup;
+extern thread_local dJointGroupID odeContactGroup;
 
 namespace robogen {
 
@@ -46,7 +46,8 @@ const int MAX_CONTACTS = 32; // maximum number of contact points per body
 
 
 CollisionData::CollisionData(boost::shared_ptr<Scenario> scenario) :
-		scenario_(scenario), hasObstacleCollisions_(false) {
+		scenario_(scenario), hasObstacleCollisions_(false),
+		numContacts_(0) {
 
 	//numCulled = 0;
 
@@ -86,6 +87,13 @@ void odeCollisionCallback(void *data, dGeomID o1, dGeomID o2) {
 
 	CollisionData *collisionData = static_cast<CollisionData*>(data);
 
+	// Static geometry lives in its own space (see Environment), collide its
+	// content only against the geom or space it overlaps with
+	if (dGeomIsSpace(o1) || dGeomIsSpace(o2)) {
+		dSpaceCollide2(o1, o2, data, &odeCollisionCallback);
+		return;
+	}
+
 	// Since we are now using complex bodies, just because two bodies
 	// are connected with a joint does not mean we should ignore their
 	// collision.  Instead we need to use the ignoreCollision method define
@@ -96,6 +104,11 @@ void odeCollisionCallback(void *data, dGeomID o1, dGeomID o2) {
 
 	dBodyID b1 = dGeomGetBody(o1);
 	dBodyID b2 = dGeomGetBody(o2);
+
+	// nothing to do between two geoms that cannot move
+	if (!b1 && !b2) {
+		return;
+	}
 	//if (b1 && b2 && dAreConnectedExcluding (b1,b2,dJointTypeContact)) {
 	if (collisionData->ignoreCollision(o1, o2) ) {
 		//collisionData->numCulled++;
@@ -126,6 +139,7 @@ void odeCollisionCallback(void *data, dGeomID o1, dGeomID o2) {
 
 	if (collisionCounts > 0) {
 		collisionData->testObstacleCollisons(o1, o2);
+		collisionData->addContacts(collisionCounts);
 	}
 
 
@@ -59,12 +59,26 @@ public :
 	}
 	void testObstacleCollisons(dGeomID o1, dGeomID o2);
 
+	inline void addContacts(int contacts) {
+		numContacts_ += contacts;
+	}
+
+	/**
+	 * @return number of contact joints created since the last call
+	 */
+	inline unsigned int takeNumContacts() {
+		unsigned int numContacts = numContacts_;
+		numContacts_ = 0;
+		return numContacts;
+	}
+
 	//unsigned int numCulled ;
 
 private :
 	boost::shared_ptr<Scenario> scenario_;
 	std::map<dGeomID, boost::shared_ptr<Model> > geomModelMap_;
 	bool hasObstacleCollisions_;
+	unsigned int numContacts_;
 
 };
 
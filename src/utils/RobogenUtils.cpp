@@ -31,6 +31,7 @@
 #include <iostream>
 
 #include "utils/RobogenUtils.h"
+#include "utils/EvaluationArena.h"
 #include "PartList.h"
 
 //#define DEBUG_CONNECT
@@ -238,7 +239,7 @@ boost::shared_ptr<Joint> RobogenUtils::connect(boost::shared_ptr<Model> a,
 
 	// Create a joint to hold pieces in position
 
-	boost::shared_ptr<Joint> joint(new Joint());
+	boost::shared_ptr<Joint> joint = arenaShared<Joint>();
 	joint->createFixed(odeWorld, a->getSlot(slotA), b->getSlot(slotB),
 			connectionJointGroup);
 	return joint;
@@ -255,18 +256,18 @@ boost::shared_ptr<Model> RobogenUtils::createModel(
 	boost::shared_ptr<Model> model;
 	if (bodyPart.type().compare(PART_TYPE_CORE_COMPONENT) == 0) {
 
-		model.reset(new CoreComponentModel(odeWorld, odeSpace, id, true,
-				true));
+		model = arenaShared<CoreComponentModel>(odeWorld, odeSpace, id, true,
+				true);
 
 	} else if (bodyPart.type().compare(PART_TYPE_CORE_COMPONENT_NO_IMU) == 0) {
 
-		model.reset(new CoreComponentModel(odeWorld, odeSpace, id, true,
-				false));
+		model = arenaShared<CoreComponentModel>(odeWorld, odeSpace, id, true,
+				false);
 
 	} else if (bodyPart.type().compare(PART_TYPE_FIXED_BRICK) == 0) {
 
-		model.reset(new CoreComponentModel(odeWorld, odeSpace, id, false,
-											false));
+		model = arenaShared<CoreComponentModel>(odeWorld, odeSpace, id, false,
+											false);
 
 	} else if (bodyPart.type().compare(PART_TYPE_PARAM_JOINT) == 0) {
 
@@ -277,31 +278,31 @@ boost::shared_ptr<Model> RobogenUtils::createModel(
 			return boost::shared_ptr<Model>();
 		}
 
-		model.reset(
-				new ParametricBrickModel(odeWorld, odeSpace, id,
+		model =
+				arenaShared<ParametricBrickModel>(odeWorld, odeSpace, id,
 						bodyPart.evolvableparam(0).paramvalue(),
 						bodyPart.evolvableparam(1).paramvalue(),
-						bodyPart.evolvableparam(2).paramvalue()));
+						bodyPart.evolvableparam(2).paramvalue());
 #ifdef ALLOW_ROTATIONAL_COMPONENTS
 	} else if (bodyPart.type().compare(PART_TYPE_ROTATOR) == 0) {
 
-		model.reset(new RotateJointModel(odeWorld, odeSpace, id));
+		model = arenaShared<RotateJointModel>(odeWorld, odeSpace, id);
 #endif
 	} else if (bodyPart.type().compare(PART_TYPE_PASSIVE_HINGE) == 0) {
 
-		model.reset(new HingeModel(odeWorld, odeSpace, id));
+		model = arenaShared<HingeModel>(odeWorld, odeSpace, id);
 
 	} else if (bodyPart.type().compare(PART_TYPE_ACTIVE_HINGE) == 0) {
 
-		model.reset(new ActiveHingeModel(odeWorld, odeSpace, id));
+		model = arenaShared<ActiveHingeModel>(odeWorld, odeSpace, id);
 #ifdef ALLOW_CARDANS
 	} else if (bodyPart.type().compare(PART_TYPE_PASSIVE_CARDAN) == 0) {
 
-		model.reset(new CardanModel(odeWorld, odeSpace, id));
+		model = arenaShared<CardanModel>(odeWorld, odeSpace, id);
 
 	} else if (bodyPart.type().compare(PART_TYPE_ACTIVE_CARDAN) == 0) {
 
-		model.reset(new ActiveCardanModel(odeWorld, odeSpace, id));
+		model = arenaShared<ActiveCardanModel>(odeWorld, odeSpace, id);
 #endif
 #ifdef ALLOW_ROTATIONAL_COMPONENTS
 	} else if (bodyPart.type().compare(PART_TYPE_PASSIVE_WHEEL) == 0) {
@@ -314,9 +315,9 @@ boost::shared_ptr<Model> RobogenUtils::createModel(
 			return boost::shared_ptr<Model>();
 		}
 
-		model.reset(
-				new PassiveWheelModel(odeWorld, odeSpace, id,
-						bodyPart.evolvableparam(0).paramvalue()));
+		model =
+				arenaShared<PassiveWheelModel>(odeWorld, odeSpace, id,
+						bodyPart.evolvableparam(0).paramvalue());
 
 	} else if (bodyPart.type().compare(PART_TYPE_ACTIVE_WHEEL) == 0) {
 
@@ -327,9 +328,9 @@ boost::shared_ptr<Model> RobogenUtils::createModel(
 			return boost::shared_ptr<Model>();
 		}
 
-		model.reset(
-				new ActiveWheelModel(odeWorld, odeSpace, id,
-						bodyPart.evolvableparam(0).paramvalue()));
+		model =
+				arenaShared<ActiveWheelModel>(odeWorld, odeSpace, id,
+						bodyPart.evolvableparam(0).paramvalue());
 
 	} else if (bodyPart.type().compare(PART_TYPE_ACTIVE_WHEG) == 0) {
 
@@ -339,23 +340,23 @@ boost::shared_ptr<Model> RobogenUtils::createModel(
 			return boost::shared_ptr<Model>();
 		}
 
-		model.reset(
-				new ActiveWhegModel(odeWorld, odeSpace, id,
-						bodyPart.evolvableparam(0).paramvalue()));
+		model =
+				arenaShared<ActiveWhegModel>(odeWorld, odeSpace, id,
+						bodyPart.evolvableparam(0).paramvalue());
 #endif
 #ifdef IR_SENSORS_ENABLED
 	} else if (bodyPart.type().compare(PART_TYPE_IR_SENSOR) == 0) {
 
-		model.reset(new IrSensorModel(odeWorld, odeSpace, id));
+		model = arenaShared<IrSensorModel>(odeWorld, odeSpace, id);
 #endif
 #ifdef TOUCH_SENSORS_ENABLED
 	} else if (bodyPart.type().compare(PART_TYPE_TOUCH_SENSOR) == 0) {
 
-		model.reset(new TouchSensorModel(odeWorld, odeSpace, id));
+		model = arenaShared<TouchSensorModel>(odeWorld, odeSpace, id);
 #endif
 	} else if (bodyPart.type().compare(PART_TYPE_LIGHT_SENSOR) == 0) {
 
-		model.reset(new LightSensorModel(odeWorld, odeSpace, id, false));
+		model = arenaShared<LightSensorModel>(odeWorld, odeSpace, id, false);
 
 	}
 
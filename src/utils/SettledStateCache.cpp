@@ -0,0 +1,231 @@
+/*
+ * @(#) SettledStateCache.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include <cstring>
+#include <deque>
+#include <map>
+#include <set>
+#include <boost/thread/mutex.hpp>
+#include "config/RobogenConfig.h"
+#include "model/objects/BoxObstacle.h"
+#include "scenario/Environment.h"
+#include "scenario/Scenario.h"
+#include "utils/SettledStateCache.h"
+#include "Robot.h"
+
+namespace robogen {
+
+namespace {
+
+struct BodyState {
+	dReal position[3];
+	dReal quaternion[4];
+	dReal linearVelocity[3];
+	dReal angularVelocity[3];
+	bool enabled;
+};
+
+boost::mutex settledStatesMutex;
+
+/**
+ * Cached states, keyed by the full key rather than by a hash of it, so that
+ * a body never gets the state of another
+ */
+std::map<std::string, std::vector<BodyState> > settledStates;
+
+/**
+ * Keys in insertion order, to drop the oldest states
+ */
+std::deque<std::string> settledStatesOrder;
+
+void appendValues(std::string &key, const dReal *values, unsigned int n) {
+	key.append(reinterpret_cast<const char *>(values), n * sizeof(dReal));
+}
+
+void appendSize(std::string &key, std::size_t size) {
+	key.append(reinterpret_cast<const char *>(&size), sizeof(size));
+}
+
+/**
+ * Put the bodies in the given state. Bodies are enabled first and their
+ * velocity averages restarted, so that auto-disabling also continues the
+ * same way whatever the bodies did before.
+ */
+void applyStates(const std::vector<BodyState> &states,
+		const std::vector<dBodyID> &bodies) {
+	for (unsigned int i = 0; i < bodies.size(); ++i) {
+		const BodyState &state = states[i];
+		dBodySetPosition(bodies[i], state.position[0], state.position[1],
+				state.position[2]);
+		dBodySetQuaternion(bodies[i], state.quaternion);
+		dBodySetLinearVel(bodies[i], state.linearVelocity[0],
+				state.linearVelocity[1], state.linearVelocity[2]);
+		dBodySetAngularVel(bodies[i], state.angularVelocity[0],
+				state.angularVelocity[1], state.angularVelocity[2]);
+		dBodySetAutoDisableAverageSamplesCount(bodies[i],
+				dBodyGetAutoDisableAverageSamplesCount(bodies[i]));
+		dBodyEnable(bodies[i]);
+		if (!state.enabled) {
+			dBodyDisable(bodies[i]);
+		}
+	}
+}
+
+}
+
+std::vector<dBodyID> SettledStateCache::getBodies(
+		boost::shared_ptr<Scenario> scenario) {
+
+	std::vector<dBodyID> bodies;
+	// simple bodies merged by optimizePhysics share their composite's body
+	std::set<dBodyID> seen;
+
+	std::vector<boost::shared_ptr<Model> > bodyParts =
+			scenario->getRobot()->getBodyParts();
+	for (unsigned int i = 0; i < bodyParts.size(); ++i) {
+		std::vector<boost::shared_ptr<SimpleBody> > partBodies =
+				bodyParts[i]->getBodies();
+		for (unsigned int j = 0; j < partBodies.size(); ++j) {
+			dBodyID body = partBodies[j]->getBody();
+			if (body != 0 && seen.insert(body).second) {
+				bodies.push_back(body);
+			}
+		}
+	}
+
+	std::vector<boost::shared_ptr<Obstacle> > obstacles =
+			scenario->getEnvironment()->getObstacles();
+	for (unsigned int i = 0; i < obstacles.size(); ++i) {
+		boost::shared_ptr<BoxObstacle> box =
+				boost::dynamic_pointer_cast<BoxObstacle>(obstacles[i]);
+		if (box && box->getBody() != 0 && seen.insert(box->getBody()).second) {
+			bodies.push_back(box->getBody());
+		}
+	}
+
+	return bodies;
+}
+
+std::string SettledStateCache::getKey(
+		const robogenMessage::Robot &robotMessage,
+		const RobogenConfig &configuration,
+		const std::vector<dBodyID> &bodies) {
+
+	std::string key;
+	std::string body = robotMessage.body().SerializeAsString();
+	appendSize(key, body.size());
+	key.append(body);
+
+	// the settle phase is the same whatever the length of the simulation
+	// and the noise, since neither sensors nor brain are used
+	robogenMessage::SimulatorConf conf = configuration.serialize();
+	conf.clear_ntimesteps();
+	conf.clear_sensornoiselevel();
+	conf.clear_motornoiselevel();
+	std::string confBytes = conf.SerializeAsString();
+	appendSize(key, confBytes.size());
+	key.append(confBytes);
+
+	// the start pose, as left by the scenario
+	appendSize(key, bodies.size());
+	for (unsigned int i = 0; i < bodies.size(); ++i) {
+		appendValues(key, dBodyGetPosition(bodies[i]), 3);
+		appendValues(key, dBodyGetQuaternion(bodies[i]), 4);
+	}
+	return key;
+}
+
+bool SettledStateCache::restore(const std::string &key,
+		const std::vector<dBodyID> &bodies) {
+
+	boost::mutex::scoped_lock lock(settledStatesMutex);
+	std::map<std::string, std::vector<BodyState> >::const_iterator it =
+			settledStates.find(key);
+	if (it == settledStates.end()) {
+		return false;
+	}
+	applyStates(it->second, bodies);
+	return true;
+}
+
+void SettledStateCache::store(const std::string &key,
+		const std::vector<dBodyID> &bodies) {
+
+	std::vector<BodyState> states(bodies.size());
+	for (unsigned int i = 0; i < bodies.size(); ++i) {
+		BodyState &state = states[i];
+		std::memcpy(state.position, dBodyGetPosition(bodies[i]),
+				sizeof(state.position));
+		std::memcpy(state.quaternion, dBodyGetQuaternion(bodies[i]),
+				sizeof(state.quaternion));
+		std::memcpy(state.linearVelocity, dBodyGetLinearVel(bodies[i]),
+				sizeof(state.linearVelocity));
+		std::memcpy(state.angularVelocity, dBodyGetAngularVel(bodies[i]),
+				sizeof(state.angularVelocity));
+		state.enabled = dBodyIsEnabled(bodies[i]) != 0;
+	}
+
+	boost::mutex::scoped_lock lock(settledStatesMutex);
+	std::map<std::string, std::vector<BodyState> >::const_iterator it =
+			settledStates.find(key);
+	if (it == settledStates.end()) {
+		if (settledStatesOrder.size() >= MAX_ENTRIES) {
+			settledStates.erase(settledStatesOrder.front());
+			settledStatesOrder.pop_front();
+		}
+		it = settledStates.insert(std::make_pair(key, states)).first;
+		settledStatesOrder.push_back(key);
+	}
+	// continue from the state as stored, not from the one integration left
+	// (e.g. the rotation matrices), as runs restoring it will
+	applyStates(it->second, bodies);
+}
+
+bool SettledStateCache::isSettled(const std::vector<dBodyID> &bodies,
+		float velocity) {
+	const dReal maxSquared = velocity * velocity;
+	for (unsigned int i = 0; i < bodies.size(); ++i) {
+		if (!dBodyIsEnabled(bodies[i])) {
+			continue;
+		}
+		const dReal *linear = dBodyGetLinearVel(bodies[i]);
+		const dReal *angular = dBodyGetAngularVel(bodies[i]);
+		if (dCalcVectorDot3(linear, linear) > maxSquared ||
+				dCalcVectorDot3(angular, angular) > maxSquared) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void SettledStateCache::clear() {
+	boost::mutex::scoped_lock lock(settledStatesMutex);
+	settledStates.clear();
+	settledStatesOrder.clear();
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * @(#) SettledStateCache.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_SETTLED_STATE_CACHE_H_
+#define ROBOGEN_SETTLED_STATE_CACHE_H_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <ode/ode.h>
+#include "robogen.pb.h"
+
+namespace robogen {
+
+class RobogenConfig;
+class Scenario;
+
+/**
+ * Process-wide cache of the states the robots reach at the end of the settle
+ * phase, when they are dropped on the terrain with their motors held and
+ * their brain disabled.
+ *
+ * The settle phase of a body only depends on the body, on its start pose and
+ * on the simulator configuration, so states are keyed by these. A run that
+ * settles continues from the state it stores, exactly as later runs that
+ * restore it, so the first evaluation of a body does not differ from the
+ * next ones.
+ */
+class SettledStateCache {
+
+public:
+
+	/**
+	 * Maximum number of cached states, the oldest are dropped first
+	 */
+	static const unsigned int MAX_ENTRIES = 4096;
+
+	/**
+	 * Consecutive steps the bodies have to stay below the settle velocity
+	 */
+	static const unsigned int SETTLED_STEPS = 10;
+
+	/**
+	 * @return the bodies of the robot and the movable obstacles of the
+	 * 		scenario, in a stable order, without duplicates
+	 */
+	static std::vector<dBodyID> getBodies(
+			boost::shared_ptr<Scenario> scenario);
+
+	/**
+	 * Serialize the body of the robot, the configuration, and the current
+	 * pose of the bodies, i.e. everything the settle phase depends on
+	 */
+	static std::string getKey(const robogenMessage::Robot &robotMessage,
+			const RobogenConfig &configuration,
+			const std::vector<dBodyID> &bodies);
+
+	/**
+	 * Put the bodies in their cached settled state
+	 * @return false if there is no state cached for this key
+	 */
+	static bool restore(const std::string &key,
+			const std::vector<dBodyID> &bodies);
+
+	/**
+	 * Cache the current state of the bodies, then put them in the cached
+	 * state, which is the one of another run if it stored the key first
+	 */
+	static void store(const std::string &key,
+			const std::vector<dBodyID> &bodies);
+
+	/**
+	 * @return true if no body moves faster than the given speed
+	 */
+	static bool isSettled(const std::vector<dBodyID> &bodies,
+			float velocity);
+
+	/**
+	 * Drop all cached states
+	 */
+	static void clear();
+
+};
+
+}
+
+#endif /* ROBOGEN_SETTLED_STATE_CACHE_H_ */
@@ -0,0 +1,123 @@
+/*
+ * @(#) SimulationProfile.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#include "utils/SimulationProfile.h"
+
+namespace robogen {
+
+namespace {
+
+const char *PHASE_NAMES[SimulationProfile::NUM_PHASES] = {
+		"robotConstruction",
+		"scenarioInit",
+		"settle",
+		"collision",
+		"worldStep",
+		"imuSensors",
+		"irSensors",
+		"lightSensors",
+		"touchSensors",
+		"otherSensors",
+		"brain",
+		"motors",
+		"scenarioCallbacks",
+		"logging"
+};
+
+}
+
+SimulationProfile::SimulationProfile() {
+	reset();
+}
+
+void SimulationProfile::reset() {
+	for (unsigned int i = 0; i < NUM_PHASES; ++i) {
+		seconds_[i] = 0;
+		calls_[i] = 0;
+	}
+	steps_ = 0;
+	contacts_ = 0;
+	maxContacts_ = 0;
+	evaluations_ = 0;
+}
+
+void SimulationProfile::merge(const SimulationProfile &other) {
+	for (unsigned int i = 0; i < NUM_PHASES; ++i) {
+		seconds_[i] += other.seconds_[i];
+		calls_[i] += other.calls_[i];
+	}
+	steps_ += other.steps_;
+	contacts_ += other.contacts_;
+	if (other.maxContacts_ > maxContacts_) {
+		maxContacts_ = other.maxContacts_;
+	}
+	evaluations_ += other.evaluations_;
+}
+
+void SimulationProfile::merge(
+		const robogenMessage::SimulationProfile &message) {
+	for (int i = 0; i < message.phases_size(); ++i) {
+		const robogenMessage::PhaseProfile &phase = message.phases(i);
+		for (unsigned int j = 0; j < NUM_PHASES; ++j) {
+			if (phase.name().compare(PHASE_NAMES[j]) == 0) {
+				seconds_[j] += phase.seconds();
+				calls_[j] += phase.calls();
+				break;
+			}
+		}
+	}
+	steps_ += message.steps();
+	contacts_ += message.contacts();
+	if (message.maxcontacts() > maxContacts_) {
+		maxContacts_ = message.maxcontacts();
+	}
+	evaluations_ += message.evaluations();
+}
+
+void SimulationProfile::serialize(
+		robogenMessage::SimulationProfile &message) const {
+	message.clear_phases();
+	for (unsigned int i = 0; i < NUM_PHASES; ++i) {
+		robogenMessage::PhaseProfile *phase = message.add_phases();
+		phase->set_name(PHASE_NAMES[i]);
+		phase->set_seconds(seconds_[i]);
+		phase->set_calls(calls_[i]);
+	}
+	message.set_steps(steps_);
+	message.set_contacts(contacts_);
+	message.set_maxcontacts(maxContacts_);
+	message.set_evaluations(evaluations_);
+}
+
+const char *SimulationProfile::getPhaseName(unsigned int phase) {
+	if (phase >= NUM_PHASES) {
+		return "";
+	}
+	return PHASE_NAMES[phase];
+}
+
+}
@@ -0,0 +1,200 @@
+/*
+ * @(#) SimulationProfile.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+#ifndef ROBOGEN_SIMULATION_PROFILE_H_
+#define ROBOGEN_SIMULATION_PROFILE_H_
+
+#include <chrono>
+#include <string>
+#include "robogen.pb.h"
+
+namespace robogen {
+
+/**
+ * Wall time and number of calls spent in each phase of a simulation,
+ * together with the number of contacts created by the collision callback.
+ *
+ * The simulator always fills one of these: timing a phase is a single clock
+ * read, as each lap also starts the next one.
+ */
+class SimulationProfile {
+
+public:
+
+	enum Phase {
+		ROBOT_CONSTRUCTION,
+		SCENARIO_INIT,
+		SETTLE,
+		COLLISION,
+		WORLD_STEP,
+		IMU_SENSORS,
+		IR_SENSORS,
+		LIGHT_SENSORS,
+		TOUCH_SENSORS,
+		OTHER_SENSORS,
+		BRAIN,
+		MOTORS,
+		SCENARIO_CALLBACKS,
+		LOGGING,
+		NUM_PHASES
+	};
+
+	typedef std::chrono::steady_clock Clock;
+
+	SimulationProfile();
+
+	/**
+	 * Clear all counters
+	 */
+	void reset();
+
+	/**
+	 * @return the current time, to start timing a phase
+	 */
+	static inline Clock::time_point now() {
+		return Clock::now();
+	}
+
+	/**
+	 * Account the time since start to the given phase
+	 * @return the current time, to start timing the next phase
+	 */
+	inline Clock::time_point lap(Phase phase, const Clock::time_point &start) {
+		Clock::time_point end = Clock::now();
+		seconds_[phase] += std::chrono::duration<double>(end - start).count();
+		++calls_[phase];
+		return end;
+	}
+
+	/**
+	 * Count a simulation step
+	 * @param contacts number of contact joints created during the step
+	 */
+	inline void addStep(unsigned int contacts) {
+		++steps_;
+		contacts_ += contacts;
+		if (contacts > maxContacts_) {
+			maxContacts_ = contacts;
+		}
+	}
+
+	/**
+	 * Count a completed simulation (one trial of an evaluation)
+	 */
+	inline void addEvaluation() {
+		++evaluations_;
+	}
+
+	/**
+	 * Add the counters of another profile to this one
+	 */
+	void merge(const SimulationProfile &other);
+
+	/**
+	 * Add the counters of a profile message to this one.  Phases are
+	 * matched by name, unknown ones are ignored.
+	 */
+	void merge(const robogenMessage::SimulationProfile &message);
+
+	/**
+	 * Convert the profile into a profile message
+	 */
+	void serialize(robogenMessage::SimulationProfile &message) const;
+
+	/**
+	 * @return name of the phase, as used in messages and reports
+	 */
+	static const char *getPhaseName(unsigned int phase);
+
+	double getSeconds(unsigned int phase) const {
+		return seconds_[phase];
+	}
+
+	unsigned long long getCalls(unsigned int phase) const {
+		return calls_[phase];
+	}
+
+	unsigned long long getSteps() const {
+		return steps_;
+	}
+
+	unsigned long long getContacts() const {
+		return contacts_;
+	}
+
+	unsigned int getMaxContacts() const {
+		return maxContacts_;
+	}
+
+	unsigned int getEvaluations() const {
+		return evaluations_;
+	}
+
+	/**
+	 * @return true if nothing was recorded
+	 */
+	bool isEmpty() const {
+		return evaluations_ == 0 && steps_ == 0;
+	}
+
+private:
+
+	/**
+	 * Wall time spent in each phase, in seconds
+	 */
+	double seconds_[NUM_PHASES];
+
+	/**
+	 * Number of times each phase was timed
+	 */
+	unsigned long long calls_[NUM_PHASES];
+
+	/**
+	 * Number of simulation steps
+	 */
+	unsigned long long steps_;
+
+	/**
+	 * Total number of contact joints
+	 */
+	unsigned long long contacts_;
+
+	/**
+	 * Maximum number of contact joints in a single step
+	 */
+	unsigned int maxContacts_;
+
+	/**
+	 * Number of completed simulations
+	 */
+	unsigned int evaluations_;
+
+};
+
+}
+
+#endif /* ROBOGEN_SIMULATION_PROFILE_H_ */
@@ -127,4 +127,19 @@ void TcpSocket::interrupt() {
    this->ioService_.stop();
 }
 
+void TcpSocket::notifyFork(boost::asio::io_service::fork_event event) {
+   this->ioService_.notify_fork(event);
+   if (event == boost::asio::io_service::fork_child) {
+      if (this->acceptor_ != NULL) {
+         this->acceptor_->close();
+         this->acceptor_.reset();
+      }
+   } else if (event == boost::asio::io_service::fork_parent) {
+      if (this->socket_ != NULL) {
+         this->socket_->close();
+         this->socket_.reset();
+      }
+   }
+}
+
 }
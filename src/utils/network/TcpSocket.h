@@ -98,6 +98,15 @@ public:
     */
    virtual void interrupt();
 
+   /**
+    * Keep the socket usable across a fork(). Call with fork_prepare before
+    * forking, then with fork_child in the child, which only keeps the
+    * accepted connection, and with fork_parent in the parent, which only
+    * keeps accepting new connections.
+    * @param event the fork stage
+    */
+   void notifyFork(boost::asio::io_service::fork_event event);
+
 private:
 
    /**
@@ -169,14 +169,16 @@ std::string EMSCRIPTEN_KEEPALIVE simulationViewer(int tab, std::string robotFile
 
 
 #else
+#include <boost/thread/mutex.hpp>
+#include "viewer/PoseLog.h"
 #include "viewer/Viewer.h"
 #endif
 
 // ODE World
-dWorldID odeWorld;
+thread_local dWorldID odeWorld;
 
 // Container for collisions
-dJointGroupID odeContactGroup;
+thread_local dJointGroupID odeContactGroup;
 
 bool interrupted;
 
@@ -220,6 +222,15 @@ void printUsage(char *argv[]) {
 			<< "exists." << std::endl
 			<< "          (Default is to keep creating new output "
 			<< "directories with incrementing suffixes)." << std::endl
+			<< std::endl << "      --replay <LOG, STRING>" << std::endl
+			<< "          Replay a run recorded with --output instead of "
+			<< "simulating it." << std::endl
+			<< "          <LOG> is the output directory of the run, or its "
+			<< "poseLog.bin file." << std::endl
+			<< "          The robot, configuration and start position must "
+			<< "be the ones of the run." << std::endl
+			<< "          Runs of several start positions are played one "
+			<< "trial after the other." << std::endl
 			<< std::endl << "      --record <N, INTEGER> <DIR, STRING>"
 			<< std::endl
 			<< "          Save frames to file (for video rendering)."
@@ -253,10 +264,90 @@ void printHelp() {
 	ConfigurationReader::parseConfigurationFile("help");
 }
 
+#ifndef EMSCRIPTEN
+/**
+ * Shows a recorded run: the robot and the scenario are built as for a
+ * simulation, but instead of stepping the physics their bodies are moved to
+ * the poses of the log
+ */
+bool runReplay(boost::shared_ptr<Scenario> scenario,
+		const robogenMessage::Robot &robotMessage, Viewer *viewer,
+		PoseLog &poseLog) {
+
+	{
+		boost::mutex::scoped_lock lock(getOdeInitMutex());
+		dInitODE();
+	}
+	odeWorld = dWorldCreate();
+	dSpaceID odeSpace = dSimpleSpaceCreate(0);
+	odeContactGroup = dJointGroupCreate(0);
+
+	bool success = false;
+
+	// wrap all this in block so things get cleaned up before shutting down
+	// ode
+	{
+		boost::shared_ptr<Robot> robot(new Robot);
+		if (!robot->init(odeWorld, odeSpace, robotMessage)) {
+			std::cout << "Problems decoding the robot. Quit." << std::endl;
+		} else if (!scenario->init(odeWorld, odeSpace, robot) ||
+				!scenario->setupSimulation()) {
+			std::cout << "Cannot initialize scenario. Quit." << std::endl;
+		} else if (poseLog.matches(scenario) &&
+				viewer->configureScene(robot->getBodyParts(), scenario)) {
+
+			viewer->startReplay();
+			std::cout << "Replaying " << poseLog.getNumFrames()
+					<< " frames (" << poseLog.getDuration() << "s) of "
+					<< poseLog.getNumTrials() << " trial(s)" << std::endl;
+
+			double time = 0;
+			unsigned int shownFrame = poseLog.getNumFrames();
+			unsigned int shownTrial = poseLog.getNumTrials();
+			success = true;
+			while (!viewer->done()) {
+				time = viewer->advanceReplay(time, poseLog.getDuration(),
+						poseLog.getTimeStep());
+				unsigned int frame = poseLog.getFrame(time);
+				if (frame != shownFrame) {
+					double frameTime = poseLog.apply(frame, scenario);
+					if (frameTime < 0) {
+						success = false;
+						break;
+					}
+					// the simulated time restarts with every trial
+					unsigned int trial = poseLog.getTrial(frame);
+					if (trial != shownTrial && poseLog.getNumTrials() > 1) {
+						std::cout << "Trial " << (trial + 1) << " of "
+								<< poseLog.getNumTrials() << std::endl;
+					}
+					if (viewer->isPaused()) {
+						std::cout << "Frame " << frame << ", trial "
+								<< (trial + 1) << ", t = " << frameTime
+								<< "s" << std::endl;
+					}
+					shownFrame = frame;
+					shownTrial = trial;
+				}
+				viewer->drawReplay();
+			}
+		}
+	}
+
+	scenario->prune();
+	dJointGroupDestroy(odeContactGroup);
+	dSpaceDestroy(odeSpace);
+	dWorldDestroy(odeWorld);
+	{
+		boost::mutex::scoped_lock lock(getOdeInitMutex());
+		dCloseODE();
+	}
+	return success;
+}
+
 /**
  * Decodes a robot saved on file and visualize it
  */
-#ifndef EMSCRIPTEN
 int main(int argc, char *argv[]) {
 	startRobogen();
 
@@ -296,6 +387,8 @@ int main(int argc, char *argv[]) {
 	bool writeWebGL = false;
 	bool overwrite = false;
 
+	std::string replayLog;
+
 	int currentArg = 3;
 	if (argc >= 4 && !boost::starts_with(argv[3], "--")) {
 		std::stringstream ss(argv[3]);
@@ -403,6 +496,17 @@ int main(int argc, char *argv[]) {
 			writeWebGL = true;
 		} else if (std::string("--overwrite").compare(argv[currentArg]) == 0) {
 			overwrite = true;
+		} else if (std::string("--replay").compare(argv[currentArg]) == 0) {
+			if (argc < (currentArg + 2)) {
+				std::cerr << "Must specify a pose log or output directory "
+						<< "with option --replay." << std::endl;
+				exitRobogen(EXIT_FAILURE);
+			}
+			currentArg++;
+			replayLog = argv[currentArg];
+			if (fixed_is_directory(replayLog)) {
+				replayLog += "/poseLog.bin";
+			}
 		}
 
 	}
@@ -425,6 +529,12 @@ int main(int argc, char *argv[]) {
 		exitRobogen(EXIT_FAILURE);
 	}
 
+	if (!replayLog.empty() && (writeLog || recording || !visualize)) {
+		std::cerr << "A replay needs visualization, and cannot write output "
+				<< "files or record frames." << std::endl;
+		exitRobogen(EXIT_FAILURE);
+	}
+
 	if (overwrite && (!writeLog)) {
 		std::cerr << "No output directory was specified, so there is " <<
 				"nothing to overwrite." << std::endl;
@@ -457,6 +567,21 @@ int main(int argc, char *argv[]) {
 	}
 	scenario->setStartingPosition(desiredStart);
 
+	// ---------------------------------------
+	// Replay a recorded run
+	// ---------------------------------------
+
+	if (!replayLog.empty()) {
+		PoseLog poseLog;
+		if (!poseLog.open(replayLog)) {
+			exitRobogen(EXIT_FAILURE);
+		}
+		Viewer *viewer = new Viewer(startPaused, debug, speed);
+		bool success = runReplay(scenario, robotMessage, viewer, poseLog);
+		delete viewer;
+		exitRobogen(success ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
 	// ---------------------------------------
 	// Set up log files
 	// ---------------------------------------
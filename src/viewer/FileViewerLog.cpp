@@ -48,8 +48,10 @@
 #define SENSOR_LABEL_FILE "sensorLabels.txt"
 #define SENSOR_LOG_FILE "sensorLog.txt"
 #define MOTOR_LOG_FILE "motorLog.txt"
+#define POSE_LOG_FILE "poseLog.bin"
 #define TIME_LOG_FILE "timeLog.txt"
 #define ARDUINO_NN_FILE "NeuralNetwork.h"
+#define ARDUINO_FIXED_NN_FILE "NeuralNetworkFixed.h"
 #define BODY_FILE "bodyRepresentation.txt"
 #define LOG_COL_WIDTH 12
 #define OCTAVE_SCRIPT "robogenPlot.m"
@@ -126,6 +128,11 @@ bool FileViewerLog::init(boost::shared_ptr<Robot> robot,
 		return false;
 	}
 
+	// open pose log
+	if (!poseLog_.create(logPath_ + "/" + POSE_LOG_FILE)) {
+		return false;
+	}
+
 	// compile neural network representation for Arduino
 	// open motor log
 	std::string arduinoNNPath = logPath_ + "/" + ARDUINO_NN_FILE;
@@ -137,6 +144,18 @@ bool FileViewerLog::init(boost::shared_ptr<Robot> robot,
 	}
 	ArduinoNNCompiler::compile(*robot.get(),*config.get(),arduinoNN);
 
+	// and its fixed-point version
+	std::string arduinoFixedNNPath = logPath_ + "/" + ARDUINO_FIXED_NN_FILE;
+	std::ofstream arduinoFixedNN;
+	arduinoFixedNN.open(arduinoFixedNNPath.c_str());
+	if (!arduinoFixedNN.is_open()){
+		std::cout << "Can't open arduino fixed-point neural net log file"
+				<< std::endl;
+		return false;
+	}
+	ArduinoNNCompiler::compileFixedPoint(*robot.get(),*config.get(),
+			arduinoFixedNN);
+
 	// compile neural network representation for Body
 
 	/*std::string bodyPath = logPath_ + "/" + BODY_FILE;
@@ -288,6 +307,11 @@ void FileViewerLog::logMotors(float motorValues[], int n){
 	motorLog_ << std::endl;
 }
 
+void FileViewerLog::logPoses(double time,
+		boost::shared_ptr<Scenario> scenario) {
+	poseLog_.log(time, scenario);
+}
+
 std::string FileViewerLog::getWebGLFileName() {
 	return logPath_ + "/" + WEBGL_FILE;
 }
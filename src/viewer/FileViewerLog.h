@@ -39,6 +39,7 @@
 #include <boost/shared_ptr.hpp>
 #include "Robot.h"
 #include "config/RobogenConfig.h"
+#include "viewer/PoseLog.h"
 
 namespace robogen{
 
@@ -93,6 +94,11 @@ public:
 	 */
 	void logMotors(float motorValues[], int n);
 
+	/**
+	 * Writes the poses of all bodies to the pose log, used for replays
+	 */
+	void logPoses(double time, boost::shared_ptr<Scenario> scenario);
+
 	inline bool isWriteWebGL() { return writeWebGL_; }
 
 	std::string getWebGLFileName();
@@ -101,6 +107,7 @@ private:
 	std::ofstream trajectoryLog_;
 	std::ofstream sensorLog_;
 	std::ofstream motorLog_;
+	PoseLog poseLog_;
 	/**
 	 * Log directory
 	 */
@@ -32,6 +32,12 @@
 #include <osgGA/GUIEventHandler>
 #include <osg/Version>
 
+/**
+ * Seeking steps of the replay, in seconds
+ */
+#define REPLAY_SHORT_SEEK 1.0
+#define REPLAY_LONG_SEEK 10.0
+
 namespace robogen {
 
 class KeyboardHandler: public osgGA::GUIEventHandler {
@@ -40,7 +46,9 @@ public:
 
 	KeyboardHandler(bool startPaused, bool geoms, bool meshes/*, bool transparent*/)
 		: osgGA::GUIEventHandler(), paused_(startPaused), geoms_(geoms),
-		  meshes_(meshes), /*transparent_(transparent),*/ quit_(false)  {
+		  meshes_(meshes), /*transparent_(transparent),*/ quit_(false),
+		  replay_(false), seekSeconds_(0), seekFrames_(0),
+		  seekFraction_(-1), speedScale_(1)  {
 
 	}
 
@@ -80,7 +88,7 @@ public:
 			//	break;
 
 			default:
-				return false;
+				return replay_ && handleReplayKey(ea.getKey());
 
 			}
 
@@ -124,8 +132,95 @@ public:
 		return quit_;
 	}
 
+	/**
+	 * Enables the replay keys: arrows to seek, home/end, 0-9 to jump to
+	 * 0-90%, comma/period to step one frame and +/- to change the speed
+	 */
+	void setReplay(bool replay) {
+		replay_ = replay;
+	}
+
+	/**
+	 * The seeks requested since the last call, in seconds
+	 */
+	double takeSeekSeconds() {
+		double seek = seekSeconds_;
+		seekSeconds_ = 0;
+		return seek;
+	}
+
+	/**
+	 * The seeks requested since the last call, in frames
+	 */
+	int takeSeekFrames() {
+		int seek = seekFrames_;
+		seekFrames_ = 0;
+		return seek;
+	}
+
+	/**
+	 * The position requested since the last call, as a fraction of the
+	 * replay, or a negative value if none
+	 */
+	double takeSeekFraction() {
+		double seek = seekFraction_;
+		seekFraction_ = -1;
+		return seek;
+	}
+
+	/**
+	 * The factor to apply to the replay speed since the last call
+	 */
+	double takeSpeedScale() {
+		double scale = speedScale_;
+		speedScale_ = 1;
+		return scale;
+	}
+
 private:
 
+	bool handleReplayKey(int key) {
+		if (key >= '0' && key <= '9') {
+			seekFraction_ = (key - '0') / 10.0;
+			return true;
+		}
+		switch (key) {
+		case osgGA::GUIEventAdapter::KEY_Left:
+			seekSeconds_ -= REPLAY_SHORT_SEEK;
+			return true;
+		case osgGA::GUIEventAdapter::KEY_Right:
+			seekSeconds_ += REPLAY_SHORT_SEEK;
+			return true;
+		case osgGA::GUIEventAdapter::KEY_Down:
+			seekSeconds_ -= REPLAY_LONG_SEEK;
+			return true;
+		case osgGA::GUIEventAdapter::KEY_Up:
+			seekSeconds_ += REPLAY_LONG_SEEK;
+			return true;
+		case osgGA::GUIEventAdapter::KEY_Home:
+			seekFraction_ = 0;
+			return true;
+		case osgGA::GUIEventAdapter::KEY_End:
+			seekFraction_ = 1;
+			return true;
+		case ',':
+			seekFrames_--;
+			return true;
+		case '.':
+			seekFrames_++;
+			return true;
+		case '+':
+		case '=':
+			speedScale_ *= 2;
+			return true;
+		case '-':
+			speedScale_ /= 2;
+			return true;
+		default:
+			return false;
+		}
+	}
+
 	bool paused_;
 
 	bool geoms_;
@@ -136,6 +231,16 @@ private:
 
 	bool quit_;
 
+	bool replay_;
+
+	double seekSeconds_;
+
+	int seekFrames_;
+
+	double seekFraction_;
+
+	double speedScale_;
+
 };
 
 }
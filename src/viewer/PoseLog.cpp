@@ -0,0 +1,322 @@
+/*
+ * @(#) PoseLog.cpp   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include "model/Model.h"
+#include "model/SimpleBody.h"
+#include "model/objects/BoxObstacle.h"
+#include "scenario/Environment.h"
+#include "viewer/PoseLog.h"
+#include "Robot.h"
+
+#define POSE_LOG_MAGIC "RGPL"
+#define POSE_LOG_VERSION 2
+#define POSE_LOG_HEADER_SIZE 16
+#define POSE_SIZE 7
+
+namespace robogen {
+
+PoseLog::PoseLog() : headerWritten_(false), nBodies_(0), nObstacles_(0),
+		timeStep_(0), nFrames_(0) {
+}
+
+PoseLog::~PoseLog() {
+}
+
+void PoseLog::getBodies(boost::shared_ptr<Scenario> scenario,
+		std::vector<boost::shared_ptr<SimpleBody> > &bodies,
+		std::vector<boost::shared_ptr<BoxObstacle> > &obstacles) {
+
+	const std::vector<boost::shared_ptr<Model> > &bodyParts =
+			scenario->getRobot()->getBodyParts();
+	for (unsigned int i = 0; i < bodyParts.size(); ++i) {
+		std::vector<int> ids = bodyParts[i]->getIDs();
+		for (unsigned int j = 0; j < ids.size(); ++j) {
+			bodies.push_back(bodyParts[i]->getBody(ids[j]));
+		}
+	}
+
+	const std::vector<boost::shared_ptr<Obstacle> > &allObstacles =
+			scenario->getEnvironment()->getObstacles();
+	for (unsigned int i = 0; i < allObstacles.size(); ++i) {
+		boost::shared_ptr<BoxObstacle> obstacle =
+				boost::dynamic_pointer_cast<BoxObstacle>(allObstacles[i]);
+		if (obstacle && !obstacle->isStatic()) {
+			obstacles.push_back(obstacle);
+		}
+	}
+}
+
+std::streamoff PoseLog::getFrameSize() const {
+	return sizeof(double) + sizeof(boost::uint32_t) +
+			(nBodies_ + nObstacles_) * POSE_SIZE * sizeof(float);
+}
+
+bool PoseLog::create(const std::string &fileName) {
+	headerWritten_ = false;
+	out_.open(fileName.c_str(), std::ios::out | std::ios::binary);
+	if (!out_.is_open()) {
+		std::cerr << "Cannot create pose log '" << fileName << "'"
+				<< std::endl;
+		return false;
+	}
+	return true;
+}
+
+void PoseLog::log(double time, boost::shared_ptr<Scenario> scenario) {
+
+	std::vector<boost::shared_ptr<SimpleBody> > bodies;
+	std::vector<boost::shared_ptr<BoxObstacle> > obstacles;
+	getBodies(scenario, bodies, obstacles);
+
+	if (!headerWritten_) {
+		nBodies_ = bodies.size();
+		nObstacles_ = obstacles.size();
+		boost::uint32_t header[3] = { POSE_LOG_VERSION, nBodies_,
+				nObstacles_ };
+		out_.write(POSE_LOG_MAGIC, 4);
+		out_.write(reinterpret_cast<const char*>(header), sizeof(header));
+		headerWritten_ = true;
+	}
+
+	frame_.resize((nBodies_ + nObstacles_) * POSE_SIZE);
+	float *pose = frame_.empty() ? NULL : &frame_[0];
+	for (unsigned int i = 0; i < nBodies_ + nObstacles_; ++i) {
+		osg::Vec3 position;
+		osg::Quat attitude;
+		if (i < nBodies_) {
+			position = bodies[i]->getPosition();
+			attitude = bodies[i]->getAttitude();
+		} else {
+			position = obstacles[i - nBodies_]->getPosition();
+			attitude = obstacles[i - nBodies_]->getAttitude();
+		}
+		pose[0] = position.x();
+		pose[1] = position.y();
+		pose[2] = position.z();
+		pose[3] = attitude.x();
+		pose[4] = attitude.y();
+		pose[5] = attitude.z();
+		pose[6] = attitude.w();
+		pose += POSE_SIZE;
+	}
+
+	boost::uint32_t trial = scenario->getCurTrial();
+	out_.write(reinterpret_cast<const char*>(&time), sizeof(double));
+	out_.write(reinterpret_cast<const char*>(&trial), sizeof(trial));
+	if (!frame_.empty()) {
+		out_.write(reinterpret_cast<const char*>(&frame_[0]),
+				frame_.size() * sizeof(float));
+	}
+}
+
+bool PoseLog::open(const std::string &fileName) {
+
+	in_.open(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!in_.is_open()) {
+		std::cerr << "Cannot open pose log '" << fileName << "'"
+				<< std::endl;
+		return false;
+	}
+
+	char magic[4];
+	boost::uint32_t header[3];
+	in_.read(magic, 4);
+	in_.read(reinterpret_cast<char*>(header), sizeof(header));
+	if (!in_ || std::memcmp(magic, POSE_LOG_MAGIC, 4) != 0 ||
+			header[0] != POSE_LOG_VERSION) {
+		std::cerr << "'" << fileName << "' is not a pose log" << std::endl;
+		return false;
+	}
+	nBodies_ = header[1];
+	nObstacles_ = header[2];
+	frame_.resize((nBodies_ + nObstacles_) * POSE_SIZE);
+
+	// a truncated last frame (interrupted run) is ignored
+	in_.seekg(0, std::ios::end);
+	std::streamoff size = in_.tellg();
+	nFrames_ = (size - POSE_LOG_HEADER_SIZE) / getFrameSize();
+	if (nFrames_ == 0) {
+		std::cerr << "The pose log '" << fileName << "' has no frames"
+				<< std::endl;
+		return false;
+	}
+
+	// trials are logged in order, the first frame of each one is found by
+	// bisection
+	double time;
+	boost::uint32_t trial, lastTrial;
+	if (!readFrameHeader(0, time, trial) ||
+			!readFrameHeader(nFrames_ - 1, time, lastTrial)) {
+		return false;
+	}
+	trialStarts_.assign(1, 0);
+	while (trial < lastTrial) {
+		unsigned int low = trialStarts_.back(), high = nFrames_ - 1;
+		while (high - low > 1) {
+			unsigned int middle = low + (high - low) / 2;
+			boost::uint32_t middleTrial;
+			if (!readFrameHeader(middle, time, middleTrial)) {
+				return false;
+			}
+			if (middleTrial > trial) {
+				high = middle;
+			} else {
+				low = middle;
+			}
+		}
+		trialStarts_.push_back(high);
+		if (!readFrameHeader(high, time, trial)) {
+			return false;
+		}
+	}
+
+	// frames are logged at every simulation step, the same in all trials
+	timeStep_ = 0;
+	for (unsigned int i = 0; i < trialStarts_.size(); ++i) {
+		unsigned int end = (i + 1 < trialStarts_.size()) ?
+				trialStarts_[i + 1] : nFrames_;
+		if (end - trialStarts_[i] > 1) {
+			double firstTime, secondTime;
+			if (!readFrameHeader(trialStarts_[i], firstTime, trial) ||
+					!readFrameHeader(trialStarts_[i] + 1, secondTime,
+							trial)) {
+				return false;
+			}
+			timeStep_ = secondTime - firstTime;
+			break;
+		}
+	}
+	return true;
+}
+
+bool PoseLog::readFrameHeader(unsigned int frame, double &time,
+		boost::uint32_t &trial) {
+	in_.clear();
+	in_.seekg(POSE_LOG_HEADER_SIZE + frame * getFrameSize());
+	in_.read(reinterpret_cast<char*>(&time), sizeof(double));
+	in_.read(reinterpret_cast<char*>(&trial), sizeof(trial));
+	if (!in_) {
+		std::cerr << "Cannot read frame " << frame << " of the pose log"
+				<< std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool PoseLog::matches(boost::shared_ptr<Scenario> scenario) {
+	std::vector<boost::shared_ptr<SimpleBody> > bodies;
+	std::vector<boost::shared_ptr<BoxObstacle> > obstacles;
+	getBodies(scenario, bodies, obstacles);
+	if (bodies.size() != nBodies_ || obstacles.size() != nObstacles_) {
+		std::cerr << "The pose log has " << nBodies_ << " bodies and "
+				<< nObstacles_ << " moving obstacles, the robot and "
+				<< "configuration have " << bodies.size() << " and "
+				<< obstacles.size() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+unsigned int PoseLog::getNumFrames() const {
+	return nFrames_;
+}
+
+unsigned int PoseLog::getNumTrials() const {
+	return trialStarts_.size();
+}
+
+double PoseLog::getTimeStep() const {
+	return timeStep_;
+}
+
+double PoseLog::getDuration() const {
+	return (nFrames_ - 1) * timeStep_;
+}
+
+unsigned int PoseLog::getFrame(double time) const {
+	if (timeStep_ <= 0 || time <= 0) {
+		return 0;
+	}
+	double frame = std::floor(time / timeStep_ + 1e-6);
+	if (frame >= nFrames_ - 1) {
+		return nFrames_ - 1;
+	}
+	return (unsigned int) frame;
+}
+
+unsigned int PoseLog::getTrial(unsigned int frame) const {
+	return std::upper_bound(trialStarts_.begin(), trialStarts_.end(), frame)
+			- trialStarts_.begin() - 1;
+}
+
+double PoseLog::apply(unsigned int frame,
+		boost::shared_ptr<Scenario> scenario) {
+
+	if (frame >= nFrames_) {
+		return -1;
+	}
+
+	double time;
+	boost::uint32_t trial;
+	if (!readFrameHeader(frame, time, trial)) {
+		return -1;
+	}
+	if (!frame_.empty()) {
+		in_.read(reinterpret_cast<char*>(&frame_[0]),
+				frame_.size() * sizeof(float));
+	}
+	if (!in_) {
+		std::cerr << "Cannot read frame " << frame << " of the pose log"
+				<< std::endl;
+		return -1;
+	}
+
+	std::vector<boost::shared_ptr<SimpleBody> > bodies;
+	std::vector<boost::shared_ptr<BoxObstacle> > obstacles;
+	getBodies(scenario, bodies, obstacles);
+
+	const float *pose = frame_.empty() ? NULL : &frame_[0];
+	for (unsigned int i = 0; i < nBodies_ + nObstacles_; ++i) {
+		osg::Vec3 position(pose[0], pose[1], pose[2]);
+		osg::Quat attitude(pose[3], pose[4], pose[5], pose[6]);
+		if (i < nBodies_) {
+			bodies[i]->setPosition(position);
+			bodies[i]->setAttitude(attitude);
+		} else {
+			obstacles[i - nBodies_]->setPose(position, attitude);
+		}
+		pose += POSE_SIZE;
+	}
+	return time;
+}
+
+}
@@ -0,0 +1,176 @@
+/*
+ * @(#) PoseLog.h   1.0   Oct 17, 2026
+ *
+ * agent (agent@local)
+ *
+ * The ROBOGEN Framework
+ * Copyright © 2026 agent
+ *
+ * Laboratory of Intelligent Systems, EPFL
+ *
+ * This file is part of the ROBOGEN Framework.
+ *
+ * The ROBOGEN Framework is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License (GPL)
+ * as published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @(#) $Id$
+ */
+
+#ifndef ROBOGEN_POSE_LOG_H_
+#define ROBOGEN_POSE_LOG_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include "scenario/Scenario.h"
+
+namespace robogen {
+
+class SimpleBody;
+class BoxObstacle;
+
+/**
+ * \brief Binary log of the pose of every body during a run
+ *
+ * Records, at every simulation step, the position and attitude of all the
+ * bodies of the robot and of the non-static obstacles, so that the run can
+ * be replayed without simulating it again. Frames have a fixed size, so any
+ * of them can be read directly.
+ *
+ * The trials of a run follow each other in the log, each frame holding the
+ * index of its trial: the simulated time restarts at every trial, so frames
+ * are located by their index, the replay showing the trials one after the
+ * other.
+ *
+ * The bodies are identified by their order: the robot body parts, each
+ * with its bodies by increasing id, then the non-static obstacles, as they
+ * are built from the robot and configuration files of the run.
+ */
+class PoseLog {
+
+public:
+
+	PoseLog();
+
+	~PoseLog();
+
+	/**
+	 * Creates a log for writing, the header is written with the first frame
+	 * @return true if the file could be created
+	 */
+	bool create(const std::string &fileName);
+
+	/**
+	 * Appends the current poses of the scenario's bodies
+	 * @param time simulated time since the start of the current trial
+	 */
+	void log(double time, boost::shared_ptr<Scenario> scenario);
+
+	/**
+	 * Opens a log for reading
+	 * @return true if it is a valid pose log
+	 */
+	bool open(const std::string &fileName);
+
+	/**
+	 * @return true if the log matches the bodies of the given scenario
+	 */
+	bool matches(boost::shared_ptr<Scenario> scenario);
+
+	/**
+	 * @return the number of frames
+	 */
+	unsigned int getNumFrames() const;
+
+	/**
+	 * @return the number of trials
+	 */
+	unsigned int getNumTrials() const;
+
+	/**
+	 * @return the simulated time between two frames
+	 */
+	double getTimeStep() const;
+
+	/**
+	 * @return the time between the first and the last frame, all trials
+	 * being played one after the other
+	 */
+	double getDuration() const;
+
+	/**
+	 * @param time replay time, since the first frame of the first trial
+	 * @return the frame showing the given time
+	 */
+	unsigned int getFrame(double time) const;
+
+	/**
+	 * @return the index of the trial a frame belongs to
+	 */
+	unsigned int getTrial(unsigned int frame) const;
+
+	/**
+	 * Moves the scenario's bodies to their pose in the given frame
+	 * @return the simulated time of the frame in its trial, or a negative
+	 * value if it cannot be read
+	 */
+	double apply(unsigned int frame, boost::shared_ptr<Scenario> scenario);
+
+private:
+
+	/**
+	 * The bodies of a scenario, in log order
+	 */
+	static void getBodies(boost::shared_ptr<Scenario> scenario,
+			std::vector<boost::shared_ptr<SimpleBody> > &bodies,
+			std::vector<boost::shared_ptr<BoxObstacle> > &obstacles);
+
+	/**
+	 * Size in bytes of one frame
+	 */
+	std::streamoff getFrameSize() const;
+
+	/**
+	 * Reads the time and trial of a frame
+	 * @return false if they cannot be read
+	 */
+	bool readFrameHeader(unsigned int frame, double &time,
+			boost::uint32_t &trial);
+
+	std::ofstream out_;
+	std::ifstream in_;
+
+	bool headerWritten_;
+
+	unsigned int nBodies_;
+	unsigned int nObstacles_;
+	double timeStep_;
+	unsigned int nFrames_;
+
+	/**
+	 * First frame of every trial
+	 */
+	std::vector<unsigned int> trialStarts_;
+
+	/**
+	 * Buffer for one frame (position then attitude of each body)
+	 */
+	std::vector<float> frame_;
+
+};
+
+}
+
+#endif /* ROBOGEN_POSE_LOG_H_ */
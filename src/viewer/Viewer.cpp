@@ -32,6 +32,7 @@
 #include <boost/format.hpp>
 #include <sstream>
 #include <osgDB/WriteFile>
+#include <OpenThreads/Thread>
 
 #include "model/objects/BoxObstacle.h"
 
@@ -263,13 +264,7 @@ bool Viewer::frame(double simulatedTime, unsigned int numTimeSteps) {
 		this->timeSinceLastFrame += frameTime;
 	}
 
-	if(this->debugActive) {
-		for(unsigned int i=0; i<renderModels.size(); i++) {
-			renderModels[i]->togglePrimitives(keyboardEvent->showGeoms());
-			renderModels[i]->toggleMeshes(keyboardEvent->showMeshes());
-			//renderModels[i]->toggleTransparency(keyboardEvent->isTransparent());
-		}
-	}
+	this->updateDebugDisplay();
 
 
 	this->tick1 = boost::posix_time::microsec_clock::universal_time();
@@ -331,4 +326,66 @@ bool Viewer::isPaused() {
 	return this->keyboardEvent->isPaused();
 }
 
+void Viewer::updateDebugDisplay() {
+	if(this->debugActive) {
+		for(unsigned int i=0; i<renderModels.size(); i++) {
+			renderModels[i]->togglePrimitives(keyboardEvent->showGeoms());
+			renderModels[i]->toggleMeshes(keyboardEvent->showMeshes());
+			//renderModels[i]->toggleTransparency(keyboardEvent->isTransparent());
+		}
+	}
+}
+
+void Viewer::startReplay() {
+	this->keyboardEvent->setReplay(true);
+	this->tick1 = boost::posix_time::microsec_clock::universal_time();
+
+	std::cout << "Press LEFT/RIGHT to seek " << REPLAY_SHORT_SEEK
+			<< "s, DOWN/UP to seek " << REPLAY_LONG_SEEK << "s." << std::endl;
+	std::cout << "Press HOME/END or 0-9 to jump to the start, the end, "
+			<< "or 0-90% of the replay." << std::endl;
+	std::cout << "Press , and . to step one frame back or forward."
+			<< std::endl;
+	std::cout << "Press + and - to change the speed." << std::endl;
+}
+
+double Viewer::advanceReplay(double time, double duration, double timeStep) {
+	this->tick2 = boost::posix_time::microsec_clock::universal_time();
+	boost::posix_time::time_duration diff = this->tick2 - this->tick1;
+	this->tick1 = this->tick2;
+
+	if(!this->isPaused()) {
+		time += (diff.total_microseconds() / 1000000.0) * speedFactor;
+	}
+
+	time += keyboardEvent->takeSeekSeconds();
+	time += keyboardEvent->takeSeekFrames() * timeStep;
+	double fraction = keyboardEvent->takeSeekFraction();
+	if (fraction >= 0) {
+		time = fraction * duration;
+	}
+
+	double speedScale = keyboardEvent->takeSpeedScale();
+	if (speedScale != 1) {
+		speedFactor *= speedScale;
+		std::cout << "Replay speed: " << speedFactor << "x" << std::endl;
+	}
+
+	return std::max(0.0, std::min(time, duration));
+}
+
+void Viewer::drawReplay() {
+	this->updateDebugDisplay();
+	this->viewer->frame();
+
+	// no physics to wait for, so do not draw faster than the display
+	boost::posix_time::time_duration diff =
+			boost::posix_time::microsec_clock::universal_time() - this->tick1;
+	double remaining = MIN_TIME_BETWEEN_REPLAY_FRAMES -
+			diff.total_microseconds() / 1000000.0;
+	if (remaining > 0) {
+		OpenThreads::Thread::microSleep(remaining * 1000000);
+	}
+}
+
 } /* namespace robogen */
@@ -40,6 +40,7 @@
 #include "RenderModels.h"
 
 #define MAX_TIME_BETWEEN_FRAMES 0.05
+#define MIN_TIME_BETWEEN_REPLAY_FRAMES 0.016
 
 namespace robogen{
 
@@ -81,12 +82,36 @@ public:
 
 	bool isPaused();
 
+	/**
+	 * Replay mode: enables the keys to seek and change the speed
+	 */
+	void startReplay();
+
+	/**
+	 * Advances the replay by the wall time elapsed since the last call,
+	 * scaled by the speed factor (unless paused), and applies the seeks
+	 * requested with the keyboard
+	 * params:
+	 * 		time: the replay time shown so far (in seconds)
+	 * 		duration: the length of the replay (in seconds)
+	 * 		timeStep: the time between two recorded frames
+	 * returns:
+	 * 		the replay time to show now
+	 */
+	double advanceReplay(double time, double duration, double timeStep);
+
+	/**
+	 * Draws a frame of the replay
+	 */
+	void drawReplay();
+
 
 private:
 	void init(bool startPaused, bool debugActive, double speedFactor,
 			bool recording,
 			unsigned int recordFrequency, std::string recordDirectoryName);
 	void record();
+	void updateDebugDisplay();
 
 	osgViewer::Viewer *viewer;
 	osg::ref_ptr<osg::Camera> camera;
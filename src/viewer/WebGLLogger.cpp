@@ -61,6 +61,7 @@ const char *WebGLLogger::MAP_DATA_TAG = "data";
 const char *WebGLLogger::OBSTACLE_TAGS = "obstacles";
 const char *WebGLLogger::OBSTACLE_DEF_TAG = "definition";
 const char *WebGLLogger::OBSTACLE_LOG_TAG = "log";
+const char *WebGLLogger::OBSTACLE_STATIC_TAG = "static";
 const char *WebGLLogger::LIGHT_TAGS = "lights";
 
 WebGLLogger::WebGLLogger(std::string inFileName,
@@ -76,6 +77,7 @@ WebGLLogger::WebGLLogger(std::string inFileName,
 	this->jsonLights = json_object();
 	this->jsonObstaclesLog = json_object();
 	this->jsonObstaclesDefinition = json_array();
+	this->jsonObstaclesStatic = json_array();
 	this->bodies = std::vector<struct BodyDescriptor>();
 	this->writeObstaclesDefinition();
 	this->generateBodyCollection();
@@ -117,9 +119,40 @@ void WebGLLogger::writeObstaclesDefinition() {
 		json_array_append(json_size, json_real(size.x()));
 		json_array_append(json_size, json_real(size.y()));
 		json_array_append(json_size, json_real(size.z()));
+
+		// static obstacles never move, so their pose is computed once here
+		// and shared by every frame of the log, which still holds a pose for
+		// each obstacle of the definition, in the same order
+		if (boxObstacle->isStatic()) {
+			json_array_append_new(this->jsonObstaclesStatic,
+					WebGLLogger::getPoseJSON(boxObstacle->getPosition(),
+							boxObstacle->getAttitude()));
+		} else {
+			json_array_append_new(this->jsonObstaclesStatic, json_null());
+		}
+		this->obstacles.push_back(*it);
 	}
 }
 
+json_t* WebGLLogger::getPoseJSON(const osg::Vec3 &position,
+		const osg::Quat &attitude) {
+	json_t* pose = json_array();
+	json_t* jsonAttitude = json_array();
+	json_t* jsonPosition = json_array();
+	json_array_append_new(pose, jsonAttitude);
+	json_array_append_new(pose, jsonPosition);
+
+	json_array_append_new(jsonPosition, json_real(position.x()));
+	json_array_append_new(jsonPosition, json_real(position.y()));
+	json_array_append_new(jsonPosition, json_real(position.z()));
+
+	json_array_append_new(jsonAttitude, json_real(attitude.x()));
+	json_array_append_new(jsonAttitude, json_real(attitude.y()));
+	json_array_append_new(jsonAttitude, json_real(attitude.z()));
+	json_array_append_new(jsonAttitude, json_real(attitude.w()));
+	return pose;
+}
+
 void WebGLLogger::generateBodyCollection() {
 	for (size_t i = 0; i < this->robot->getBodyParts().size(); ++i) {
 		boost::shared_ptr<Model> currentModel = this->robot->getBodyParts()[i];
@@ -286,6 +319,8 @@ void WebGLLogger::writeJSONHeaders() {
 			this->jsonObstaclesDefinition);
 	json_object_set_new(this->jsonObstacles, WebGLLogger::OBSTACLE_LOG_TAG,
 			this->jsonObstaclesLog);
+	json_object_set_new(this->jsonObstacles, WebGLLogger::OBSTACLE_STATIC_TAG,
+			this->jsonObstaclesStatic);
 	json_object_set_new(this->jsonRoot, WebGLLogger::LIGHT_TAGS,
 			this->jsonLights);
 }
@@ -301,15 +336,15 @@ void WebGLLogger::generateMapInfo() {
 		json_array_append(dims, json_real(terrain->getHeightFieldHeight()));
 		json_t *mapData = json_array();
 		json_object_set_new(this->jsonMap, WebGLLogger::MAP_DATA_TAG, mapData);
-		unsigned int cols = terrain->getHeightFieldData()->s();
-		unsigned int rows = terrain->getHeightFieldData()->t();
+		boost::shared_ptr<const HeightMap> heightMap = terrain->getHeightMap();
+		unsigned int cols = heightMap->getNumCols();
+		unsigned int rows = heightMap->getNumRows();
 		for (unsigned int i = 0; i < cols; ++i) {
 			json_t *current_row = json_array();
 			json_array_append(mapData, current_row);
 			for (unsigned int j = 0; j < rows; ++j) {
-				int value =
-						static_cast<int>(*terrain->getHeightFieldData()->data(i,
-								j));
+				int value = static_cast<int>(
+						heightMap->getSample(i, j) * 255.0f + 0.5f);
 				json_array_append(current_row, json_integer(value));
 			}
 		}
@@ -394,31 +429,19 @@ void WebGLLogger::log(double dt) {
 
 		}
 
-		std::vector<boost::shared_ptr<Obstacle> > obstacles =
-				this->scenario->getEnvironment()->getObstacles();
 		json_t* obstacles_positions = json_array();
 		json_object_set_new(this->jsonObstaclesLog, obKey.c_str(),
 				obstacles_positions);
-		for (std::vector<boost::shared_ptr<Obstacle> >::iterator it =
-				obstacles.begin(); it != obstacles.end(); ++it) {
-			json_t* obstacleLog = json_array();
-			json_t* attitude = json_array();
-			json_t* position = json_array();
-			json_array_append_new(obstacleLog, attitude);
-			json_array_append_new(obstacleLog, position);
-			json_array_append_new(obstacles_positions, obstacleLog);
-
-			osg::Vec3 currentPosition = (*it)->getPosition();
-			osg::Quat currentAttitude = (*it)->getAttitude();
-
-			json_array_append_new(position, json_real(currentPosition.x()));
-			json_array_append_new(position, json_real(currentPosition.y()));
-			json_array_append_new(position, json_real(currentPosition.z()));
-
-			json_array_append_new(attitude, json_real(currentAttitude.x()));
-			json_array_append_new(attitude, json_real(currentAttitude.y()));
-			json_array_append_new(attitude, json_real(currentAttitude.z()));
-			json_array_append_new(attitude, json_real(currentAttitude.w()));
+		for (unsigned int i = 0; i < this->obstacles.size(); ++i) {
+			json_t* staticPose = json_array_get(this->jsonObstaclesStatic, i);
+			if (!json_is_null(staticPose)) {
+				json_array_append(obstacles_positions, staticPose);
+			} else {
+				json_array_append_new(obstacles_positions,
+						WebGLLogger::getPoseJSON(
+								this->obstacles[i]->getPosition(),
+								this->obstacles[i]->getAttitude()));
+			}
 		}
 
 		lastFrame = dt;
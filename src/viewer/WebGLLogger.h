@@ -40,6 +40,7 @@
 #include <scenario/Scenario.h>
 #include <jansson.h>
 #include <model/components/ParametricBrickModel.h>
+#include <model/objects/Obstacle.h>
 
 namespace robogen {
 
@@ -68,6 +69,7 @@ public:
 	static const char* OBSTACLE_TAGS;
 	static const char* OBSTACLE_DEF_TAG;
 	static const char* OBSTACLE_LOG_TAG;
+	static const char* OBSTACLE_STATIC_TAG;
 	static const char* LIGHT_TAGS;
 
 	std::string getStructureJSON();
@@ -88,14 +90,18 @@ private:
 	json_t *jsonObstacles;
 	json_t *jsonObstaclesDefinition;
 	json_t *jsonObstaclesLog;
+	json_t *jsonObstaclesStatic;
 	json_t *jsonLights;
 
 	std::vector<struct BodyDescriptor> bodies;
+	std::vector<boost::shared_ptr<Obstacle> > obstacles;
 
 	static std::string getFormatedStringForCuboid(double width, double height,
 			double thickness);
 	static std::string getFormatedStringForCylinder(double radius,
 			double height);
+	static json_t* getPoseJSON(const osg::Vec3 &position,
+			const osg::Quat &attitude);
 
 	//disable copy constructor;
 	WebGLLogger(const WebGLLogger& that);